@@ -1190,10 +1190,14 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads, int fVerbose );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
+extern void                Gia_AigerWritePar( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int nThreads, int fVerbose );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
+extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrExt( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
 extern void                Gia_AigerWriteSimple( Gia_Man_t * pInit, char * pFileName );
 /*=== giaBalance.c ===========================================================*/
@@ -1514,6 +1518,11 @@ extern int *               Gia_SortFloats( float * pArray, int * pPerm, int nSiz
 /*=== giaSim.c ============================================================*/
 extern void                Gia_ManSimSetDefaultParams( Gia_ParSim_t * p );
 extern int                 Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
+extern int                 Gia_ManSimSimulatePattern( Gia_Man_t * p, char * pFileIn, char * pFileOut );
+extern int                 Gia_ManSimSimulatePatternBin( Gia_Man_t * p, char * pFileIn, char * pFileOut, int fVerbose );
+extern int                 Gia_ManSimPatIsBinary( char * pFileName );
+extern int                 Gia_ManSimPatAsciiToBin( char * pFileIn, char * pFileOut, int nIns, int nFrames, int fVerbose );
+extern int                 Gia_ManSimPatBinToAscii( char * pFileIn, char * pFileOut, int fVerbose );
 extern unsigned *          Gia_SimDataExt( Gia_ManSim_t * p, int i );
 extern unsigned *          Gia_SimDataCiExt( Gia_ManSim_t * p, int i );
 extern unsigned *          Gia_SimDataCoExt( Gia_ManSim_t * p, int i );
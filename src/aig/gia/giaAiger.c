@@ -22,6 +22,25 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
+#include "misc/bzlib/bzlib.h"
+#include "misc/zlib/zlib.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +50,77 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIGER_THR_MAX 64
+
+// parallel decoding of the AND gate section
+typedef struct Gia_AigerPar_t_ Gia_AigerPar_t;
+struct Gia_AigerPar_t_
+{
+    Gia_Man_t *      pNew;                          // the AIG constructed directly (or NULL)
+    int *            pNodes;                        // AIG literals of the AIGER variables
+    unsigned *       pNums;                         // two numbers (then two literals) for each AND gate
+    unsigned char *  pData;                         // the beginning of the AND gate section
+    unsigned char *  pLimit;                        // the limit on the end of the AND gate section
+    unsigned char *  pStop;                         // the end of the AND gate section
+    int              nCis;                          // the number of combinational inputs
+    int              nAnds;                         // the number of AND gates
+    int              nChunks;                       // the number of chunks processed concurrently
+    int              Phase;                         // the current phase of decoding
+    int              pCounts[GIA_AIGER_THR_MAX];    // the number of numbers ending in each chunk
+    int              pStarts[GIA_AIGER_THR_MAX];    // the index of the first of these numbers
+    int              pBufs[GIA_AIGER_THR_MAX];      // the number of buffers created in each chunk
+    int              pErrors[GIA_AIGER_THR_MAX];    // the error flag of each chunk
+};
+
+typedef struct Gia_AigerParThr_t_ Gia_AigerParThr_t;
+struct Gia_AigerParThr_t_
+{
+    Gia_AigerPar_t * p;
+    int              iChunk;
+};
+
+#define GIA_AIGER_OUT_SIZE   (1 << 20)   // the size of the output buffer
+#define GIA_AIGER_OUT_BLOCK  (1 << 16)   // the number of objects encoded by one thread at a time
+
+// streaming output of the AIGER writer
+typedef struct Gia_AigerOut_t_ Gia_AigerOut_t;
+struct Gia_AigerOut_t_
+{
+    FILE *           pFile;         // the output file
+    gzFile           pGz;           // the gzip stream (or NULL)
+    BZFILE *         pBz;           // the bzip2 stream (or NULL)
+    Vec_Str_t *      vStr;          // the output string (or NULL)
+    char *           pBuffer;       // the output buffer
+    int              nBuffer;       // the number of bytes in the buffer
+    int              fError;        // the flag of a write error
+    word             nBytes;        // the number of bytes written (before compression)
+};
+
+// encoding of one block of AND gates
+typedef struct Gia_AigerEnc_t_ Gia_AigerEnc_t;
+struct Gia_AigerEnc_t_
+{
+    Gia_Man_t *      p;             // the AIG
+    int              iBeg;          // the first object of the block
+    int              iEnd;          // the object following the last one
+    unsigned char *  pBuffer;       // the encoded AND gates
+    int              nBytes;        // the number of bytes
+};
+
+// Abc_Clock() measures the time of the calling thread, while the reading
+// speed with concurrent decoding should be measured by the wall clock
+static inline abctime Gia_AigerWallClock()
+{
+#if (defined(LIN) || defined(LIN64)) && !(__APPLE__ & __MACH__) && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    return ((abctime) ts.tv_sec) * CLOCKS_PER_SEC + (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+#else
+    return Abc_Clock();
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -83,6 +173,219 @@ void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
     fwrite( Buffer, 1, 4, pFile );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the compressed file into the buffer.]
+
+  Description [Decompresses the file with the extension ".gz" or ".bz2".
+  Returns the buffer and its size or NULL if the file cannot be read.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_FileIsCompressed( char * pFileName )
+{
+    int nLength = strlen(pFileName);
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+        return 1;
+    if ( nLength > 4 && !strcmp(pFileName + nLength - 4, ".bz2") )
+        return 2;
+    return 0;
+}
+char * Gia_FileReadCompressed( char * pFileName, int * pnFileSize )
+{
+    FILE * pFile = NULL;
+    gzFile pGz = NULL;
+    BZFILE * pBz = NULL;
+    char * pContents;
+    int nSize = 0, nCap = (1 << 20), nRead, bzError = BZ_OK;
+    if ( Gia_FileIsCompressed(pFileName) == 2 )
+    {
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pBz = BZ2_bzReadOpen( &bzError, pFile, 0, 0, NULL, 0 );
+        if ( bzError != BZ_OK )
+        {
+            BZ2_bzReadClose( &bzError, pBz );
+            fclose( pFile );
+            return NULL;
+        }
+    }
+    else
+    {
+        pGz = gzopen( pFileName, "rb" );
+        if ( pGz == NULL )
+            return NULL;
+    }
+    pContents = ABC_ALLOC( char, nCap );
+    while ( 1 )
+    {
+        if ( nSize == nCap )
+        {
+            if ( nCap == 0x7FFFFFFF )
+            {
+                nRead = -1;
+                break;
+            }
+            nCap = nCap > 0x3FFFFFFF ? 0x7FFFFFFF : 2 * nCap;
+            pContents = ABC_REALLOC( char, pContents, nCap );
+        }
+        if ( pBz )
+        {
+            nRead = BZ2_bzRead( &bzError, pBz, pContents + nSize, nCap - nSize );
+            if ( bzError != BZ_OK && bzError != BZ_STREAM_END )
+                nRead = -1;
+        }
+        else
+            nRead = gzread( pGz, pContents + nSize, nCap - nSize );
+        if ( nRead < 0 )
+            break;
+        nSize += nRead;
+        if ( nRead == 0 || bzError == BZ_STREAM_END )
+            break;
+    }
+    if ( pBz )
+    {
+        BZ2_bzReadClose( &bzError, pBz );
+        fclose( pFile );
+    }
+    else
+        gzclose( pGz );
+    if ( nRead < 0 )
+    {
+        printf( "Gia_FileReadCompressed(): Cannot decompress file \"%s\".\n", pFileName );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    *pnFileSize = nSize;
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Streaming output of the AIGER writer.]
+
+  Description [The data is collected in a buffer of fixed size, which is
+  written into the file when full. If the file name has the extension 
+  ".gz" or ".bz2", the data is compressed on the fly.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_AigerOut_t * Gia_AigerOutStart( char * pFileName )
+{
+    Gia_AigerOut_t * p;
+    FILE * pFile = NULL;
+    gzFile pGz = NULL;
+    BZFILE * pBz = NULL;
+    int bzError;
+    if ( Gia_FileIsCompressed(pFileName) == 1 )
+        pGz = gzopen( pFileName, "wb" );
+    else
+        pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL && pGz == NULL )
+        return NULL;
+    if ( Gia_FileIsCompressed(pFileName) == 2 )
+    {
+        pBz = BZ2_bzWriteOpen( &bzError, pFile, 9, 0, 0 );
+        if ( bzError != BZ_OK )
+        {
+            BZ2_bzWriteClose( &bzError, pBz, 0, NULL, NULL );
+            fclose( pFile );
+            return NULL;
+        }
+    }
+    p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    p->pFile   = pFile;
+    p->pGz     = pGz;
+    p->pBz     = pBz;
+    p->pBuffer = ABC_ALLOC( char, GIA_AIGER_OUT_SIZE );
+    return p;
+}
+void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    int bzError;
+    if ( p->nBuffer == 0 )
+        return;
+    if ( p->pGz )
+        p->fError |= (gzwrite( p->pGz, p->pBuffer, p->nBuffer ) != p->nBuffer);
+    else if ( p->pBz )
+    {
+        BZ2_bzWrite( &bzError, p->pBz, p->pBuffer, p->nBuffer );
+        p->fError |= (bzError != BZ_OK);
+    }
+    else if ( p->vStr )
+        Vec_StrPushBuffer( p->vStr, p->pBuffer, p->nBuffer );
+    else
+        p->fError |= (fwrite( p->pBuffer, 1, p->nBuffer, p->pFile ) != (size_t)p->nBuffer);
+    p->nBuffer = 0;
+}
+void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, int nBytes )
+{
+    char * pChars = (char *)pData;
+    int nCopy;
+    p->nBytes += nBytes;
+    while ( nBytes > 0 )
+    {
+        if ( p->nBuffer == GIA_AIGER_OUT_SIZE )
+            Gia_AigerOutFlush( p );
+        nCopy = Abc_MinInt( nBytes, GIA_AIGER_OUT_SIZE - p->nBuffer );
+        memcpy( p->pBuffer + p->nBuffer, pChars, nCopy );
+        p->nBuffer += nCopy;
+        pChars     += nCopy;
+        nBytes     -= nCopy;
+    }
+}
+void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pTemp;
+    va_list args;
+    int nLength;
+    va_start( args, pFormat );
+    nLength = vsnprintf( Buffer, 1000, pFormat, args );
+    va_end( args );
+    if ( nLength < 1000 )
+    {
+        Gia_AigerOutWrite( p, Buffer, nLength );
+        return;
+    }
+    pTemp = ABC_ALLOC( char, nLength + 1 );
+    va_start( args, pFormat );
+    vsnprintf( pTemp, nLength + 1, pFormat, args );
+    va_end( args );
+    Gia_AigerOutWrite( p, pTemp, nLength );
+    ABC_FREE( pTemp );
+}
+void Gia_AigerOutWriteSize( Gia_AigerOut_t * p, int nSize )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, nSize );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+int Gia_AigerOutStop( Gia_AigerOut_t * p )
+{
+    int bzError, fError;
+    Gia_AigerOutFlush( p );
+    if ( p->pGz )
+        p->fError |= (gzclose( p->pGz ) != Z_OK);
+    if ( p->pBz )
+    {
+        BZ2_bzWriteClose( &bzError, p->pBz, 0, NULL, NULL );
+        p->fError |= (bzError != BZ_OK);
+    }
+    if ( p->pFile )
+        p->fError |= (fclose( p->pFile ) != 0);
+    fError = p->fError;
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+    return !fError;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Create the array of literals to be written.]
@@ -162,6 +465,192 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Processes one chunk of the AND gate section.]
+
+  Description [Phase 0 counts the numbers ending in the given range of
+  bytes. A number ends with a byte whose most significant bit is zero.
+  Phase 1 decodes the numbers ending in the range, using their indexes
+  precomputed from the counts. Phase 2 converts the decoded numbers of
+  the given range of AND gates into literals and, if the AIG is built 
+  directly, creates the AND gates and buffers.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerReadChunk( Gia_AigerPar_t * p, int iChunk )
+{
+    word nBytes = (word)(p->pLimit - p->pData);
+    unsigned char * pBeg = p->pData + nBytes * iChunk / p->nChunks;
+    unsigned char * pEnd = p->pData + nBytes * (iChunk + 1) / p->nChunks;
+    unsigned char * pCur;
+    if ( p->Phase == 0 )
+    {
+        int Count = 0;
+        for ( pCur = pBeg; pCur < pEnd; pCur++ )
+            Count += !(*pCur & 0x80);
+        p->pCounts[iChunk] = Count;
+    }
+    else if ( p->Phase == 1 )
+    {
+        int k     = p->pStarts[iChunk];
+        int kStop = Abc_MinInt( k + p->pCounts[iChunk], 2 * p->nAnds );
+        if ( k >= kStop )
+            return;
+        // find the beginning of the first number ending in this chunk
+        for ( pCur = pBeg; pCur > p->pData && (pCur[-1] & 0x80); pCur-- );
+        while ( k < kStop )
+            p->pNums[k++] = Gia_AigerReadUnsigned( &pCur );
+        if ( k == 2 * p->nAnds )
+            p->pStop = pCur;
+    }
+    else
+    {
+        Gia_Obj_t * pObj;
+        unsigned uLit, uLit0, uLit1;
+        int i, iObj;
+        int iBeg = (int)((word)p->nAnds * iChunk / p->nChunks);
+        int iEnd = (int)((word)p->nAnds * (iChunk + 1) / p->nChunks);
+        for ( i = iBeg; i < iEnd; i++ )
+        {
+            iObj  = i + 1 + p->nCis;
+            uLit  = (unsigned)iObj << 1;
+            uLit1 = uLit  - p->pNums[2*i];
+            uLit0 = uLit1 - p->pNums[2*i+1];
+            if ( uLit1 >= uLit || uLit0 > uLit1 )
+            {
+                p->pErrors[iChunk] = 1;
+                return;
+            }
+            p->pNums[2*i]   = uLit0;
+            p->pNums[2*i+1] = uLit1;
+            if ( p->pNew == NULL )
+                continue;
+            // same as Gia_ManAppendAnd() or Gia_ManAppendBuf() since uLit0 <= uLit1
+            pObj = p->pNew->pObjs + iObj;
+            pObj->iDiff0  = iObj - Abc_Lit2Var(uLit0);
+            pObj->fCompl0 = Abc_LitIsCompl(uLit0);
+            pObj->iDiff1  = iObj - Abc_Lit2Var(uLit1);
+            pObj->fCompl1 = Abc_LitIsCompl(uLit1);
+            p->pBufs[iChunk] += (uLit0 == uLit1);
+            p->pNodes[iObj] = Abc_Var2Lit( iObj, 0 );
+        }
+    }
+}
+#ifdef ABC_USE_PTHREADS
+void * Gia_AigerReadWorker( void * pArg )
+{
+    Gia_AigerParThr_t * pThData = (Gia_AigerParThr_t *)pArg;
+    Gia_AigerReadChunk( pThData->p, pThData->iChunk );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+#endif
+void Gia_AigerReadPhase( Gia_AigerPar_t * p, int Phase )
+{
+    int i;
+    p->Phase = Phase;
+#ifdef ABC_USE_PTHREADS
+    if ( p->nChunks > 1 )
+    {
+        pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+        Gia_AigerParThr_t ThData[GIA_AIGER_THR_MAX];
+        int status;
+        for ( i = 0; i < p->nChunks; i++ )
+        {
+            ThData[i].p      = p;
+            ThData[i].iChunk = i;
+            status = pthread_create( WorkerThread + i, NULL, Gia_AigerReadWorker, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < p->nChunks; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        return;
+    }
+#endif
+    for ( i = 0; i < p->nChunks; i++ )
+        Gia_AigerReadChunk( p, i );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AND gate section using several threads.]
+
+  Description [The section is split into chunks of equal size. The first
+  pass counts the numbers ending in each chunk, which gives the index of
+  the first number decoded in each chunk by the second pass. Since each
+  number takes at most five bytes, the section is not longer than ten 
+  bytes per AND gate. Returns the array of fanin literals of the AND gates 
+  (two entries per gate) or NULL if the section is incomplete or contains 
+  invalid literals. If pNew is not NULL, also creates the AND gates in it, 
+  without structural hashing, and records their literals in pNodes. 
+  On success, *ppCur points to the first byte after the section.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned * Gia_AigerReadAndsPar( unsigned char ** ppCur, unsigned char * pEnd, int nCis, int nAnds, int nThreads, Gia_Man_t * pNew, int * pNodes )
+{
+    Gia_AigerPar_t * p = ABC_CALLOC( Gia_AigerPar_t, 1 );
+    unsigned * pNums = ABC_ALLOC( unsigned, 2 * nAnds + 1 );
+    int i, nNums = 0, nBufs = 0, fError = 0;
+    assert( nAnds > 0 );
+    p->pNew    = pNew;
+    p->pNodes  = pNodes;
+    p->pNums   = pNums;
+    p->pData   = *ppCur;
+    p->pLimit  = (word)(pEnd - *ppCur) > 10 * (word)nAnds ? *ppCur + 10 * (word)nAnds : pEnd;
+    p->nCis    = nCis;
+    p->nAnds   = nAnds;
+    p->nChunks = Abc_MaxInt( 1, Abc_MinInt(nThreads, GIA_AIGER_THR_MAX) );
+    // count the numbers ending in each chunk
+    Gia_AigerReadPhase( p, 0 );
+    for ( i = 0; i < p->nChunks; i++ )
+    {
+        p->pStarts[i] = nNums;
+        nNums += p->pCounts[i];
+    }
+    if ( nNums < 2 * nAnds )
+    {
+        fprintf( stdout, "The AND gate section is incomplete.\n" );
+        fError = 1;
+    }
+    else
+    {
+        // decode the numbers and convert them into literals
+        Gia_AigerReadPhase( p, 1 );
+        Gia_AigerReadPhase( p, 2 );
+        for ( i = 0; i < p->nChunks; i++ )
+        {
+            fError |= p->pErrors[i];
+            nBufs  += p->pBufs[i];
+        }
+        if ( fError )
+            fprintf( stdout, "The AND gate section contains invalid literals.\n" );
+    }
+    if ( !fError )
+    {
+        assert( p->pStop != NULL );
+        *ppCur = p->pStop;
+        if ( pNew )
+        {
+            pNew->nObjs  = 1 + nCis + nAnds;
+            pNew->nBufs += nBufs;
+        }
+    }
+    else
+        ABC_FREE( pNums );
+    ABC_FREE( p );
+    return pNums;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -174,15 +663,33 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [If nThreads is more than one, the AND gate section is
+  decoded concurrently. In this case, if structural hashing is skipped,
+  the AND gates are created directly in the resulting AIG.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
-    int iObj, iNode0, iNode1, fHieOnly = 0;
+    int iObj, iNode0, iNode1, fHieOnly = 0, fDirect = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
     unsigned char * pDrivers, * pSymbols, * pCur;
-    unsigned uLit0, uLit1, uLit;
+    unsigned uLit0, uLit1, uLit, * pNums = NULL;
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -282,14 +789,39 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+    // decode the AND gates concurrently
+    if ( nThreads > 1 && nAnds > 0 )
+    {
+        fDirect = !fGiaSimple && fSkipStrash;
+        if ( fDirect )
+            Vec_IntFillExtra( vNodes, 1 + nTotal, 0 );
+        pNums = Gia_AigerReadAndsPar( &pCur, (unsigned char *)pContents + nFileSize, nInputs + nLatches, nAnds, nThreads, 
+            fDirect ? pNew : NULL, fDirect ? Vec_IntArray(vNodes) : NULL );
+        if ( pNums == NULL )
+        {
+            Vec_IntFreeP( &vLits );
+            Vec_IntFree( vNodes );
+            Gia_ManStop( pNew );
+            return NULL;
+        }
+    }
+
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
+    for ( i = 0; !fDirect && i < nAnds; i++ )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pNums )
+        {
+            uLit0 = pNums[2*i];
+            uLit1 = pNums[2*i+1];
+        }
+        else
+        {
+            uLit  = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -306,6 +838,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    ABC_FREE( pNums );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -874,33 +1407,94 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [Maps the file into memory when possible, instead of 
+  copying it into a buffer. The mapping is private, so the changes made
+  by the parser are not written into the file. The files with extensions
+  ".gz" and ".bz2" are decompressed into a buffer. Decodes the AND gates 
+  using nThreads threads (see Gia_AigerReadFromMemoryPar).]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads, int fVerbose )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
-    char * pName, * pContents;
-    int nFileSize;
+    char * pName, * pContents = NULL;
+    int nFileSize, fMapped = 0;
     int RetValue;
+    abctime clk = Gia_AigerWallClock();
 
     // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    if ( Gia_FileIsCompressed(pFileName) )
+    {
+        pContents = Gia_FileReadCompressed( pFileName, &nFileSize );
+        if ( pContents == NULL )
+            return NULL;
+    }
+#ifndef _WIN32
+    else
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd >= 0 && fstat( fd, &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size > 0 && Stat.st_size < 0x7FFFFFFF )
+        {
+            pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+            if ( pContents == (char *)MAP_FAILED )
+                pContents = NULL;
+            else
+                fMapped = 1;
+        }
+        nFileSize = pContents ? (int)Stat.st_size : 0;
+        if ( fd >= 0 )
+            close( fd );
+    }
+#endif
+    if ( pContents == NULL )
+    {
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+    }
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+    pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( pContents, (size_t)nFileSize );
+    else
+#endif
     ABC_FREE( pContents );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
         pName = Gia_FileNameGeneric( pFileName );
+        if ( Gia_FileIsCompressed(pFileName) && strrchr(pName, '.') )
+            *strrchr(pName, '.') = 0;
         pNew->pName = Abc_UtilStrsav( pName );
         ABC_FREE( pName );
 
         assert( pNew->pSpec == NULL );
         pNew->pSpec = Abc_UtilStrsav( pFileName );
     }
+    if ( fVerbose )
+    {
+        double Time = 1.0 * (Gia_AigerWallClock() - clk) / CLOCKS_PER_SEC;
+        printf( "Read %.2f MB in %.2f sec (%.2f MB/s) using %d thread%s.\n", 1.0 * nFileSize / (1 << 20), 
+            Time, Time > 0 ? 1.0 * nFileSize / (1 << 20) / Time : 0.0, nThreads, nThreads > 1 ? "s" : "" );
+    }
     return pNew;
 }
 
@@ -1067,40 +1661,124 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
 /**Function*************************************************************
 
-  Synopsis    [Writes the AIG in the binary AIGER format.]
+  Synopsis    [Writes the AND gates using several threads.]
 
-  Description []
+  Description [The objects are divided into blocks, which are encoded
+  concurrently into separate buffers, nThreads blocks at a time. The
+  buffers are then written into the output stream in the original order.
+  This way, the memory used does not depend on the AIG size.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+void Gia_AigerWriteAndsBlock( Gia_AigerEnc_t * pEnc )
 {
-    int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
-    Gia_Man_t * p;
+    Gia_Man_t * p = pEnc->p;
     Gia_Obj_t * pObj;
-    Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
-    assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
-
-    if ( Gia_ManCoNum(pInit) == 0 )
+    int i, Pos = 0;
+    for ( i = pEnc->iBeg; i < pEnc->iEnd; i++ )
     {
-        printf( "AIG cannot be written because it has no POs.\n" );
-        return;
+        pObj = Gia_ManObj( p, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pEnc->pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pEnc->pBuffer, Pos, uLit1 - uLit0 );
     }
-
-    // start the output stream
-    pFile = fopen( pFileName, "wb" );
-    if ( pFile == NULL )
+    pEnc->nBytes = Pos;
+}
+#ifdef ABC_USE_PTHREADS
+void * Gia_AigerWriteWorker( void * pArg )
+{
+    Gia_AigerWriteAndsBlock( (Gia_AigerEnc_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+#endif
+void Gia_AigerWriteAnds( Gia_Man_t * p, Gia_AigerOut_t * pOut, int nThreads )
+{
+    Gia_AigerEnc_t pEncs[GIA_AIGER_THR_MAX];
+    int i, k, iStart;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, GIA_AIGER_THR_MAX) );
+    for ( k = 0; k < nThreads; k++ )
     {
-        fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
-        return;
+        pEncs[k].p       = p;
+        pEncs[k].pBuffer = ABC_ALLOC( unsigned char, 10 * GIA_AIGER_OUT_BLOCK );
     }
+    for ( iStart = 0; iStart < Gia_ManObjNum(p); iStart += nThreads * GIA_AIGER_OUT_BLOCK )
+    {
+        for ( k = 0; k < nThreads; k++ )
+        {
+            pEncs[k].iBeg = Abc_MinInt( iStart + k * GIA_AIGER_OUT_BLOCK, Gia_ManObjNum(p) );
+            pEncs[k].iEnd = Abc_MinInt( pEncs[k].iBeg + GIA_AIGER_OUT_BLOCK, Gia_ManObjNum(p) );
+        }
+#ifdef ABC_USE_PTHREADS
+        if ( nThreads > 1 )
+        {
+            pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+            int status;
+            for ( k = 0; k < nThreads; k++ )
+            {
+                status = pthread_create( WorkerThread + k, NULL, Gia_AigerWriteWorker, (void *)(pEncs + k) );  assert( status == 0 );
+            }
+            for ( k = 0; k < nThreads; k++ )
+            {
+                status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+            }
+        }
+        else
+#endif
+        for ( k = 0; k < nThreads; k++ )
+            Gia_AigerWriteAndsBlock( pEncs + k );
+        for ( k = 0; k < nThreads; k++ )
+            Gia_AigerOutWrite( pOut, pEncs[k].pBuffer, pEncs[k].nBytes );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        ABC_FREE( pEncs[i].pBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+{
+    Gia_AigerWritePar( pInit, pFileName, fWriteSymbols, fCompact, 1, XAIG_VERBOSE );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description [Writes the file through a buffer of fixed size. If the file
+  name has the extension ".gz" or ".bz2", the file is compressed on the fly.
+  The AND gates are encoded using nThreads threads.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerWriteOut( Gia_Man_t * pInit, Gia_AigerOut_t * pOut, int fCompact, int nThreads, int fVerbose )
+{
+    Gia_Man_t * p;
+    Gia_Obj_t * pObj;
+    Vec_Str_t * vStrExt;
+    int i;
 
     // create normalized AIG
     if ( !Gia_ManIsNormalized(pInit) )
@@ -1118,7 +1796,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pOut, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1127,55 +1805,31 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pOut, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pOut, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
-    {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
-    }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+    // write the nodes
+    Gia_AigerWriteAnds( p, pOut, nThreads );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1184,42 +1838,42 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pOut, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pOut, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pOut, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
 
     // write the comment
-//    fprintf( pFile, "c\n" );
-    fprintf( pFile, "c" );
+//    Gia_AigerOutPrintf( pOut, "c\n" );
+    Gia_AigerOutPrintf( pOut, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pOut, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pOut, "c" );
+        Gia_AigerOutWriteSize( pOut, 4 );
+        Gia_AigerOutWriteSize( pOut, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pOut, "d" );
+        Gia_AigerOutWriteSize( pOut, 4 );
+        Gia_AigerOutWriteSize( pOut, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1227,18 +1881,18 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "i" );
+            Gia_AigerOutWriteSize( pOut, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "o" );
+            Gia_AigerOutWriteSize( pOut, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1247,35 +1901,35 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerOutPrintf( pOut, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerOutPrintf( pOut, "f" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "g" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pOut, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1283,10 +1937,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pOut, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1295,11 +1949,11 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerOutPrintf( pOut, "w" );
+        Gia_AigerOutWriteSize( pOut, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerOutWriteSize( pOut, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1308,107 +1962,106 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pOut, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "p" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pOut, "r" );
+        Gia_AigerOutWriteSize( pOut, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutWriteSize( pOut, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerOutPrintf( pOut, "s" );
+        Gia_AigerOutWriteSize( pOut, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerOutWriteSize( pOut, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pOut, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
+        Gia_AigerOutWriteSize( pOut, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pOut, p->pCellStr, strlen(p->pCellStr) + 1 );
 //        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pOut, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutWriteSize( pOut, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutWriteSize( pOut, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutWriteSize( pOut, i );
+                Gia_AigerOutWriteSize( pOut, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "u" );
+        Gia_AigerOutWriteSize( pOut, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerOutPrintf( pOut, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "v" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pOut, "n" );
+        Gia_AigerOutWriteSize( pOut, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pOut, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pOut, "%c", '\0' );
     }
     // write comments
-    fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-    fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
-    fclose( pFile );
+    Gia_AigerOutPrintf( pOut, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+    Gia_AigerOutPrintf( pOut, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
     if ( p != pInit )
     {
         pInit->pManTime  = p->pManTime;  p->pManTime = NULL;
@@ -1417,6 +2070,67 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManStop( p );
     }
 }
+void Gia_AigerWritePar( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int nThreads, int fVerbose )
+{
+    Gia_AigerOut_t * pOut;
+    word nBytes;
+    int RetValue;
+    abctime clk = Gia_AigerWallClock();
+    assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
+
+    if ( Gia_ManCoNum(pInit) == 0 )
+    {
+        printf( "AIG cannot be written because it has no POs.\n" );
+        return;
+    }
+
+    // start the output stream
+    pOut = Gia_AigerOutStart( pFileName );
+    if ( pOut == NULL )
+    {
+        fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
+        return;
+    }
+    Gia_AigerWriteOut( pInit, pOut, fCompact, nThreads, fVerbose );
+    nBytes   = pOut->nBytes;
+    RetValue = Gia_AigerOutStop( pOut );
+    if ( !RetValue )
+        fprintf( stdout, "Gia_AigerWrite(): Writing the output file \"%s\" has failed.\n", pFileName );
+    if ( fVerbose )
+    {
+        double Time = 1.0 * (Gia_AigerWallClock() - clk) / CLOCKS_PER_SEC;
+        printf( "Wrote %.2f MB in %.2f sec (%.2f MB/s) using %d thread%s.\n", 1.0 * nBytes / (1 << 20), 
+            Time, Time > 0 ? 1.0 * nBytes / (1 << 20) / Time : 0.0, nThreads, nThreads > 1 ? "s" : "" );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG with all extensions into the string.]
+
+  Description [The result is the same as the contents of the file written
+  by Gia_AigerWrite(). Returns NULL if the AIG has no outputs.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Gia_AigerWriteIntoMemoryStrExt( Gia_Man_t * p )
+{
+    Gia_AigerOut_t * pOut;
+    Vec_Str_t * vStr;
+    assert( p->nXors == 0 && p->nMuxes == 0 );
+    if ( Gia_ManCoNum(p) == 0 )
+        return NULL;
+    pOut = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    pOut->vStr    = Vec_StrAlloc( 4 * Gia_ManObjNum(p) + 1000 );
+    pOut->pBuffer = ABC_ALLOC( char, GIA_AIGER_OUT_SIZE );
+    Gia_AigerWriteOut( p, pOut, 0, 1, 0 );
+    vStr = pOut->vStr;
+    Gia_AigerOutStop( pOut );
+    return vStr;
+}
 
 /**Function*************************************************************
 
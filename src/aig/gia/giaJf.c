@@ -1764,14 +1764,14 @@ Gia_Man_t * Jf_ManDeriveCnfMiter( Gia_Man_t * p, int fVerbose )
     pPars->fVerbose = fVerbose;
     return Jf_ManPerformMapping( p, pPars );
 }
-void Jf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int fVerbose )
+void Jf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nThreads, int fVerbose )
 {
     abctime clk = Abc_Clock();
     Gia_Man_t * pNew;
     Cnf_Dat_t * pCnf;
     pNew = Jf_ManDeriveCnfMiter( p, fVerbose );
     pCnf = (Cnf_Dat_t *)pNew->pData; pNew->pData = NULL;
-    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    Cnf_DataWriteIntoFileThreads( pCnf, pFileName, 0, NULL, NULL, nThreads );
     Gia_ManStop( pNew );
 //    if ( fVerbose )
     {
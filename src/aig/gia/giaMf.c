@@ -1724,12 +1724,12 @@ void * Mf_ManGenerateCnf( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fA
 //    Cnf_DataPrint( (Cnf_Dat_t *)pGia->pData, 1 );
     return pGia->pData;
 }
-void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int fVerbose )
+void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int nThreads, int fVerbose )
 {
     abctime clk = Abc_Clock();
     Cnf_Dat_t * pCnf;
     pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, nLutSize, fCnfObjIds, fAddOrCla, 0, fVerbose );
-    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    Cnf_DataWriteIntoFileThreads( pCnf, pFileName, 0, NULL, NULL, nThreads );
 //    if ( fVerbose )
     {
         printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
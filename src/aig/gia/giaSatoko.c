@@ -96,60 +96,36 @@ void Gia_ManSatokoReport( int iOutput, int status, abctime clk )
 
     Abc_PrintTime( 1, "Time", clk );
 }
-satoko_t * Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts )
+satoko_t * Gia_ManSatokoFromDimacs( Cnf_Dat_t * pCnf, satoko_opts_t * opts )
 {
     satoko_t * pSat = satoko_create();
-    char * pBuffer = Extra_FileReadContents( pFileName );
-    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
-    char * pTemp; int fComp, Var, VarMax = 0;
-    for ( pTemp = pBuffer; *pTemp; pTemp++ )
+    int i;
+    satoko_setnvars( pSat, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
     {
-        if ( *pTemp == 'c' || *pTemp == 'p' ) 
-        {
-            while ( *pTemp != '\n' )
-                pTemp++;
+        if ( pCnf->pClauses[i] == pCnf->pClauses[i+1] )
             continue;
-        }
-        while ( *pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n' )
-            pTemp++;
-        fComp = 0;
-        if ( *pTemp == '-' )
-            fComp = 1, pTemp++;
-        if ( *pTemp == '+' )
-            pTemp++;
-        Var = atoi( pTemp );
-        if ( Var == 0 ) {
-            if ( Vec_IntSize(vLits) > 0 ) 
-            {
-                satoko_setnvars( pSat, VarMax+1 );
-                if ( !satoko_add_clause( pSat, Vec_IntArray(vLits), Vec_IntSize(vLits) ) )
-                {
-                    satoko_destroy(pSat);
-                    Vec_IntFree( vLits );
-                    ABC_FREE( pBuffer );
-                    return NULL;
-                }
-                Vec_IntClear( vLits );
-            }
-        }
-        else 
+        if ( !satoko_add_clause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
         {
-            Var--;
-            VarMax = Abc_MaxInt( VarMax, Var );
-            Vec_IntPush( vLits, Abc_Var2Lit(Var, fComp) );
+            satoko_destroy( pSat );
+            return NULL;
         }
-        while ( *pTemp >= '0' && *pTemp <= '9' )
-            pTemp++;
     }
-    ABC_FREE( pBuffer );
-    Vec_IntFree( vLits );
+    satoko_configure( pSat, opts );
     return pSat;
 }
-void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts )
+void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts, int nThreads )
 {
     abctime clk = Abc_Clock();  
     int status = SATOKO_UNSAT;
-    satoko_t * pSat = Gia_ManSatokoFromDimacs( pFileName, opts );
+    Cnf_Dat_t * pCnf = Cnf_DataReadFromFileThreads( pFileName, nThreads );
+    satoko_t * pSat;
+    // the reader has already reported the problem
+    if ( pCnf == NULL )
+        return;
+    // the solver is not returned when the clauses are trivially UNSAT
+    pSat = Gia_ManSatokoFromDimacs( pCnf, opts );
+    Cnf_DataFree( pCnf );
     if ( pSat )
     {
         status = satoko_solve( pSat );
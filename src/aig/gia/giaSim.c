@@ -21,6 +21,13 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -36,6 +43,20 @@ unsigned * Gia_SimDataExt( Gia_ManSim_t * p, int i )    { return Gia_SimData(p,
 unsigned * Gia_SimDataCiExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCi(p, i);  }
 unsigned * Gia_SimDataCoExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCo(p, i);  }
 
+#define GIA_SIM_PAT_MAGIC  "ABC_PAT"
+
+// the header of the binary pattern file
+typedef struct Gia_SimPatHead_t_ Gia_SimPatHead_t;
+struct Gia_SimPatHead_t_
+{
+    char       Magic[8];    // the magic string
+    int        nIns;        // the number of inputs
+    int        nFrames;     // the number of frames
+    int        nPats;       // the number of patterns
+    int        nWords;      // the number of words per input and frame
+    int        Reserved[2]; // makes the size a multiple of 8 bytes
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -698,7 +719,11 @@ int Gia_ManSimWriteFile( char * pFileOut, Vec_Int_t * vPat, int nOuts )
         if ( i % nOuts == nOuts - 1 )
             fputc( '\n', pFile );
     }
-    fclose( pFile );
+    if ( fclose( pFile ) )
+    {
+        printf( "Writing output file \"%s\" has failed.\n", pFileOut );
+        return 0;
+    }
     return 1;
 }
 Vec_Int_t * Gia_ManSimSimulateOne( Gia_Man_t * p, Vec_Int_t * vPat )
@@ -729,24 +754,385 @@ Vec_Int_t * Gia_ManSimSimulateOne( Gia_Man_t * p, Vec_Int_t * vPat )
         pObj->fMark1 = 0;
     return vPatOut;
 }
-void Gia_ManSimSimulatePattern( Gia_Man_t * p, char * pFileIn, char * pFileOut )
+int Gia_ManSimSimulatePattern( Gia_Man_t * p, char * pFileIn, char * pFileOut )
 {
     Vec_Int_t * vPat, * vPatOut;
+    int RetValue;
     vPat = Gia_ManSimReadFile( pFileIn );
     if ( vPat == NULL )
-        return;
+        return 0;
     if ( Vec_IntSize(vPat) % Gia_ManPiNum(p) )
     {
         printf( "The number of 0s and 1s in the input file (%d) does not evenly divide by the number of primary inputs (%d).\n", 
             Vec_IntSize(vPat), Gia_ManPiNum(p) );
         Vec_IntFree( vPat );
-        return;
+        return 0;
     }
     vPatOut = Gia_ManSimSimulateOne( p, vPat );
-    if ( Gia_ManSimWriteFile( pFileOut, vPatOut, Gia_ManPoNum(p) ) )
+    RetValue = Gia_ManSimWriteFile( pFileOut, vPatOut, Gia_ManPoNum(p) );
+    if ( RetValue )
         printf( "Output patterns are written into file \"%s\".\n", pFileOut );
     Vec_IntFree( vPat );
     Vec_IntFree( vPatOut );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Memory-maps the binary pattern file.]
+
+  Description [The binary pattern file starts with the header (see
+  Gia_SimPatHead_t) followed by the bit-packed patterns. For each frame
+  and each input, there are nWords machine words, whose bits correspond
+  to the patterns, so that the data of one input in one frame can be
+  used directly as simulation info by the word-parallel simulator.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_ManSimPatMap( char * pFileName, word * pnBytes )
+{
+    char * pData = NULL;
+    *pnBytes = 0;
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd < 0 )
+            return NULL;
+        if ( fstat( fd, &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size > 0 )
+        {
+            pData = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( pData == (char *)MAP_FAILED )
+                pData = NULL;
+            else
+                *pnBytes = (word)Stat.st_size;
+        }
+        close( fd );
+    }
+#else
+    {
+        FILE * pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        _fseeki64( pFile, 0, SEEK_END );
+        *pnBytes = (word)_ftelli64( pFile );
+        rewind( pFile );
+        pData = ABC_ALLOC( char, *pnBytes );
+        if ( fread( pData, 1, (size_t)*pnBytes, pFile ) != (size_t)*pnBytes )
+            ABC_FREE( pData ), *pnBytes = 0;
+        fclose( pFile );
+    }
+#endif
+    return pData;
+}
+void Gia_ManSimPatUnmap( char * pData, word nBytes )
+{
+#ifndef _WIN32
+    munmap( pData, (size_t)nBytes );
+#else
+    ABC_FREE( pData );
+#endif
+}
+static int Gia_ManSimPatSeek( FILE * pFile, word Offset )
+{
+    // the pattern files may exceed 2GB, which is beyond the range of long on Windows
+#ifndef _WIN32
+    return fseeko( pFile, (off_t)Offset, SEEK_SET );
+#else
+    return _fseeki64( pFile, (__int64)Offset, SEEK_SET );
+#endif
+}
+Gia_SimPatHead_t * Gia_ManSimPatHead( char * pData, word nBytes )
+{
+    Gia_SimPatHead_t * pHead = (Gia_SimPatHead_t *)pData;
+    word nWordsMax;
+    if ( pData == NULL || nBytes < sizeof(Gia_SimPatHead_t) || strncmp(pHead->Magic, GIA_SIM_PAT_MAGIC, 8) )
+        return NULL;
+    if ( pHead->nIns <= 0 || pHead->nFrames < 0 || pHead->nPats < 0 || pHead->nWords != Abc_Bit6WordNum(pHead->nPats) )
+        return NULL;
+    // check the data size one factor at a time, so that the product cannot overflow
+    nWordsMax = (nBytes - sizeof(Gia_SimPatHead_t)) / sizeof(word) / (word)pHead->nIns;
+    if ( (word)pHead->nFrames > nWordsMax )
+        return NULL;
+    if ( pHead->nFrames > 0 && (word)pHead->nWords > nWordsMax / (word)pHead->nFrames )
+        return NULL;
+    return pHead;
+}
+int Gia_ManSimPatIsBinary( char * pFileName )
+{
+    char Magic[8] = {0};
+    FILE * pFile = fopen( pFileName, "rb" );
+    int RetValue;
+    if ( pFile == NULL )
+        return 0;
+    RetValue = fread( Magic, 1, 8, pFile ) == 8 && !strncmp(Magic, GIA_SIM_PAT_MAGIC, 8);
+    fclose( pFile );
+    return RetValue;
+}
+static inline word * Gia_ManSimPatData( Gia_SimPatHead_t * pHead, int iFrame, int iIn )
+{
+    return (word *)(pHead + 1) + ((word)iFrame * pHead->nIns + iIn) * pHead->nWords;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Converts the ASCII pattern file into the binary one.]
+
+  Description [The ASCII file lists 0s and 1s for the inputs, frame by 
+  frame, and pattern by pattern (other characters are ignored). If the 
+  number of frames is 0, the file is treated as one pattern (the format 
+  used by "&sim -I").]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimPatAsciiToBin( char * pFileIn, char * pFileOut, int nIns, int nFrames, int fVerbose )
+{
+    Gia_SimPatHead_t Head;
+    word nBits = 0, iBit = 0, nBitsPat;
+    word * pData;
+    char * pBuffer;
+    FILE * pFile;
+    int i, nRead, iPat, iFrame, iIn, RetValue = 1;
+    abctime clk = Abc_Clock();
+    assert( nIns > 0 );
+    pFile = fopen( pFileIn, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileIn );
+        return 0;
+    }
+    // count the bits
+    pBuffer = ABC_ALLOC( char, (1 << 20) );
+    while ( (nRead = (int)fread( pBuffer, 1, (1 << 20), pFile )) > 0 )
+        for ( i = 0; i < nRead; i++ )
+            nBits += (pBuffer[i] == '0' || pBuffer[i] == '1');
+    if ( nFrames == 0 )
+        nFrames = (int)(nBits / nIns);
+    nBitsPat = (word)nIns * nFrames;
+    if ( nBitsPat == 0 || nBits % nBitsPat )
+    {
+        printf( "The number of 0s and 1s in the input file (%.0f) does not evenly divide by the number of inputs (%d) times the number of frames (%d).\n", 
+            (double)nBits, nIns, nFrames );
+        ABC_FREE( pBuffer );
+        fclose( pFile );
+        return 0;
+    }
+    memset( &Head, 0, sizeof(Gia_SimPatHead_t) );
+    strncpy( Head.Magic, GIA_SIM_PAT_MAGIC, 8 );
+    Head.nIns    = nIns;
+    Head.nFrames = nFrames;
+    Head.nPats   = (int)(nBits / nBitsPat);
+    Head.nWords  = Abc_Bit6WordNum( Head.nPats );
+    // pack the bits
+    pData = ABC_CALLOC( word, (size_t)((word)nIns * nFrames * Head.nWords) );
+    rewind( pFile );
+    while ( (nRead = (int)fread( pBuffer, 1, (1 << 20), pFile )) > 0 )
+        for ( i = 0; i < nRead; i++ )
+        {
+            if ( pBuffer[i] != '0' && pBuffer[i] != '1' )
+                continue;
+            iPat   = (int)(iBit / nBitsPat);
+            iFrame = (int)(iBit % nBitsPat / nIns);
+            iIn    = (int)(iBit % nIns);
+            if ( pBuffer[i] == '1' )
+                Abc_TtSetBit( pData + ((word)iFrame * nIns + iIn) * Head.nWords, iPat );
+            iBit++;
+        }
+    fclose( pFile );
+    ABC_FREE( pBuffer );
+    // write the result
+    pFile = fopen( pFileOut, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open output file \"%s\".\n", pFileOut );
+        ABC_FREE( pData );
+        return 0;
+    }
+    RetValue &= (fwrite( &Head, sizeof(Gia_SimPatHead_t), 1, pFile ) == 1);
+    RetValue &= (fwrite( pData, sizeof(word), (size_t)((word)nIns * nFrames * Head.nWords), pFile ) == (size_t)((word)nIns * nFrames * Head.nWords));
+    RetValue &= (fclose( pFile ) == 0);
+    ABC_FREE( pData );
+    if ( !RetValue )
+        printf( "Writing output file \"%s\" has failed.\n", pFileOut );
+    else if ( fVerbose )
+    {
+        printf( "Converted %d patterns with %d frames and %d inputs into file \"%s\".  ", Head.nPats, Head.nFrames, Head.nIns, pFileOut );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Converts the binary pattern file into the ASCII one.]
+
+  Description [Writes one line per frame and an empty line after each
+  pattern.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimPatBinToAscii( char * pFileIn, char * pFileOut, int fVerbose )
+{
+    Gia_SimPatHead_t * pHead;
+    word nBytes;
+    char * pData, * pLine;
+    FILE * pFile;
+    int iPat, iFrame, iIn, RetValue;
+    abctime clk = Abc_Clock();
+    pData = Gia_ManSimPatMap( pFileIn, &nBytes );
+    if ( (pHead = Gia_ManSimPatHead(pData, nBytes)) == NULL )
+    {
+        printf( "File \"%s\" is not a valid binary pattern file.\n", pFileIn );
+        if ( pData )
+            Gia_ManSimPatUnmap( pData, nBytes );
+        return 0;
+    }
+    pFile = fopen( pFileOut, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open output file \"%s\".\n", pFileOut );
+        Gia_ManSimPatUnmap( pData, nBytes );
+        return 0;
+    }
+    pLine = ABC_ALLOC( char, pHead->nIns + 2 );
+    pLine[pHead->nIns] = '\n';
+    pLine[pHead->nIns+1] = 0;
+    for ( iPat = 0; iPat < pHead->nPats; iPat++ )
+    {
+        for ( iFrame = 0; iFrame < pHead->nFrames; iFrame++ )
+        {
+            for ( iIn = 0; iIn < pHead->nIns; iIn++ )
+                pLine[iIn] = '0' + Abc_TtGetBit( Gia_ManSimPatData(pHead, iFrame, iIn), iPat );
+            fputs( pLine, pFile );
+        }
+        fputc( '\n', pFile );
+    }
+    RetValue = (fclose( pFile ) == 0);
+    ABC_FREE( pLine );
+    if ( !RetValue )
+        printf( "Writing output file \"%s\" has failed.\n", pFileOut );
+    else if ( fVerbose )
+    {
+        printf( "Converted %d patterns with %d frames and %d inputs into file \"%s\".  ", pHead->nPats, pHead->nFrames, pHead->nIns, pFileOut );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_ManSimPatUnmap( pData, nBytes );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the binary pattern file.]
+
+  Description [Performs word-parallel simulation of all patterns starting
+  from the zero initial state. The input file is memory-mapped and the
+  simulation info of the primary inputs points directly into the mapped 
+  pages. The patterns are processed in blocks of words, so that memory 
+  for the simulation info of the internal nodes is bounded. The output 
+  values are written into the binary pattern file with the same number 
+  of frames and patterns.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimSimulatePatternBin( Gia_Man_t * p, char * pFileIn, char * pFileOut, int fVerbose )
+{
+    Gia_SimPatHead_t * pHead, HeadOut;
+    Gia_Obj_t * pObj, * pObjRo;
+    word ** ppSims, * pSims, * pSim, * pSim0, * pSim1, Mask0, Mask1, nBytes;
+    char * pData;
+    FILE * pFile;
+    int i, w, f, w0, nWordsBlock, RetValue = 1;
+    abctime clk = Abc_Clock();
+    pData = Gia_ManSimPatMap( pFileIn, &nBytes );
+    if ( (pHead = Gia_ManSimPatHead(pData, nBytes)) == NULL )
+    {
+        printf( "File \"%s\" is not a valid binary pattern file.\n", pFileIn );
+        if ( pData )
+            Gia_ManSimPatUnmap( pData, nBytes );
+        return 0;
+    }
+    if ( pHead->nIns != Gia_ManPiNum(p) )
+    {
+        printf( "The number of inputs in the pattern file (%d) does not match the number of primary inputs (%d).\n", pHead->nIns, Gia_ManPiNum(p) );
+        Gia_ManSimPatUnmap( pData, nBytes );
+        return 0;
+    }
+    pFile = fopen( pFileOut, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open output file \"%s\".\n", pFileOut );
+        Gia_ManSimPatUnmap( pData, nBytes );
+        return 0;
+    }
+    HeadOut = *pHead;
+    HeadOut.nIns = Gia_ManPoNum(p);
+    RetValue &= (fwrite( &HeadOut, sizeof(Gia_SimPatHead_t), 1, pFile ) == 1);
+    // allocate simulation info for one block of words
+    nWordsBlock = Abc_MaxInt( 1, Abc_MinInt( pHead->nWords, (1 << 24) / Gia_ManObjNum(p) ) );
+    pSims  = ABC_CALLOC( word, (size_t)Gia_ManObjNum(p) * nWordsBlock );
+    ppSims = ABC_ALLOC( word *, Gia_ManObjNum(p) );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        ppSims[i] = pSims + (size_t)i * nWordsBlock;
+    for ( w0 = 0; w0 < pHead->nWords; w0 += nWordsBlock )
+    {
+        int nWords = Abc_MinInt( nWordsBlock, pHead->nWords - w0 );
+        Gia_ManForEachRo( p, pObj, i )
+            memset( ppSims[Gia_ObjId(p, pObj)], 0, sizeof(word) * nWords );
+        for ( f = 0; f < pHead->nFrames; f++ )
+        {
+            Gia_ManForEachPi( p, pObj, i )
+                ppSims[Gia_ObjId(p, pObj)] = Gia_ManSimPatData(pHead, f, i) + w0;
+            Gia_ManForEachAnd( p, pObj, i )
+            {
+                pSim  = ppSims[i];
+                pSim0 = ppSims[Gia_ObjFaninId0(pObj, i)];
+                pSim1 = ppSims[Gia_ObjFaninId1(pObj, i)];
+                Mask0 = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+                Mask1 = Gia_ObjFaninC1(pObj) ? ~(word)0 : 0;
+                for ( w = 0; w < nWords; w++ )
+                    pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+            }
+            Gia_ManForEachCo( p, pObj, i )
+            {
+                pSim  = ppSims[Gia_ObjId(p, pObj)];
+                pSim0 = ppSims[Gia_ObjFaninId0p(p, pObj)];
+                Mask0 = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+                for ( w = 0; w < nWords; w++ )
+                    pSim[w] = pSim0[w] ^ Mask0;
+            }
+            Gia_ManForEachPo( p, pObj, i )
+            {
+                RetValue &= !Gia_ManSimPatSeek( pFile, sizeof(Gia_SimPatHead_t) + sizeof(word) * (((word)f * HeadOut.nIns + i) * HeadOut.nWords + w0) );
+                RetValue &= ((int)fwrite( ppSims[Gia_ObjId(p, pObj)], sizeof(word), nWords, pFile ) == nWords);
+            }
+            Gia_ManForEachRiRo( p, pObj, pObjRo, i )
+                memcpy( ppSims[Gia_ObjId(p, pObjRo)], ppSims[Gia_ObjId(p, pObj)], sizeof(word) * nWords );
+        }
+    }
+    RetValue &= (fclose( pFile ) == 0);
+    ABC_FREE( ppSims );
+    ABC_FREE( pSims );
+    if ( !RetValue )
+        printf( "Writing output file \"%s\" has failed.\n", pFileOut );
+    else if ( fVerbose )
+    {
+        printf( "Simulated %d patterns with %d frames in blocks of %d words.  ", pHead->nPats, pHead->nFrames, nWordsBlock );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_ManSimPatUnmap( pData, nBytes );
+    return RetValue;
 }
 
 
@@ -31,6 +31,15 @@ ABC_NAMESPACE_IMPL_START
 #define NUMBER1  3716960521u
 #define NUMBER2  2174103536u
 
+// the state of the random number generator is kept for each thread
+#if defined(ABC_USE_PTHREADS) && defined(_MSC_VER)
+#define GIA_THREAD_LOCAL __declspec(thread)
+#elif defined(ABC_USE_PTHREADS)
+#define GIA_THREAD_LOCAL __thread
+#else
+#define GIA_THREAD_LOCAL
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -39,7 +48,8 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Creates a sequence or random numbers.]
 
-  Description []
+  Description [Each thread has its own state, which starts from the
+  same seed, so that concurrent engines do not interfere.]
                
   SideEffects []
 
@@ -48,8 +58,8 @@ ABC_NAMESPACE_IMPL_START
 ***********************************************************************/
 unsigned Gia_ManRandom( int fReset )
 {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static GIA_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static GIA_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if ( fReset )
     {
         m_z = NUMBER1;
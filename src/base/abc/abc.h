@@ -207,6 +207,8 @@ struct Abc_Ntk_t_
     Vec_Int_t *       vGates;        // SC library gates
     Vec_Int_t *       vPhases;       // fanins phases in the mapped netlist
     char *            pWLoadUsed;    // wire load model used
+    Vec_Flt_t *       vPlace;        // placement coordinates (x, y) of the objects
+    float             PlaceCap;      // wire capacitance per unit of placement distance
     float *           pLutTimes;     // arrivals/requireds/slacks using LUT-delay model
     Vec_Ptr_t *       vOnehots;      // names of one-hot-encoded registers
     Vec_Int_t *       vObjPerm;      // permutation saved
@@ -1390,6 +1390,7 @@ void Abc_NtkDelete( Abc_Ntk_t * pNtk )
     Vec_PtrFree( pNtk->vAttrs );
     Vec_IntFreeP( &pNtk->vNameIds );
     ABC_FREE( pNtk->pWLoadUsed );
+    Vec_FltFreeP( &pNtk->vPlace );
     ABC_FREE( pNtk->pName );
     ABC_FREE( pNtk->pSpec );
     ABC_FREE( pNtk->pLutTimes );
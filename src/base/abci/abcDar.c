@@ -1739,7 +1739,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int nThreads, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1788,7 +1788,7 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     Vec_PtrFree( vMapped );
 */
     // write CNF into a file
-    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    Cnf_DataWriteIntoFileThreads( pCnf, pFileName, 0, NULL, NULL, nThreads );
     Cnf_DataFree( pCnf );
     Cnf_ManFree();
     Aig_ManStop( pMan );
@@ -1821,6 +1821,39 @@ int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves each output of the combinational miter separately.]
+
+  Description [Uses one incremental solver, which loads the CNF of the 
+  logic cone of each output only once. Returns 1 if all outputs are UNSAT,
+  0 if some output is SAT, and -1 otherwise. Returns the output statuses 
+  in *pvStatus and the index of the first SAT output in *piOut.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDSatOutputs( Abc_Ntk_t * pNtk, int nConfLimit, Vec_Int_t ** pvStatus, int * piOut, int fVerbose )
+{
+    Aig_Man_t * pMan;
+    Vec_Int_t * vStatus;
+    int * pModel = NULL;
+    assert( Abc_NtkIsStrash(pNtk) );
+    assert( Abc_NtkLatchNum(pNtk) == 0 );
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    vStatus = Cnf_IncSolveOutputs( pMan, nConfLimit, &pModel, fVerbose );
+    Aig_ManStop( pMan );
+    ABC_FREE( pNtk->pModel );
+    pNtk->pModel = pModel;
+    *piOut = Vec_IntFind( vStatus, 0 );
+    *pvStatus = vStatus;
+    if ( *piOut >= 0 )
+        return 0;
+    return Vec_IntFind( vStatus, -1 ) >= 0 ? -1 : 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Solves combinational miter using a SAT solver.]
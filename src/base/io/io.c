@@ -77,9 +77,15 @@ static int IoCommandWriteStatus ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteSmv    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteJson   ( Abc_Frame_t * pAbc, int argc, char **argv );
 
+static int IoCommandSaveState   ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandLoadState   ( Abc_Frame_t * pAbc, int argc, char **argv );
+
 extern void Abc_FrameCopyLTLDataBase( Abc_Frame_t *pAbc, Abc_Ntk_t * pNtk );
+extern int  Io_WriteState( Abc_Frame_t * pAbc, char * pFileName, int fVerbose );
+extern int  Io_ReadState( Abc_Frame_t * pAbc, char * pFileName, int fVerbose );
 
 extern int glo_fMapped;
+extern int glo_nThreads;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -145,6 +151,9 @@ void Io_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "I/O", "write_status",  IoCommandWriteStatus,  0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_smv",     IoCommandWriteSmv,     0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_json",    IoCommandWriteJson,    0 );
+
+    Cmd_CommandAdd( pAbc, "I/O", "save_state",    IoCommandSaveState,    0 );
+    Cmd_CommandAdd( pAbc, "I/O", "load_state",    IoCommandLoadState,    1 );
 }
 
 /**Function*************************************************************
@@ -472,6 +481,8 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCheck;
     int fUseNewParser;
     int fSaveNames;
+    int fUseFast;
+    int fVerbose;
     int c;
     extern Abc_Ntk_t * Io_ReadBlifAsAig( char * pFileName, int fCheck );
 
@@ -479,11 +490,19 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     fReadAsAig = 0;
     fUseNewParser = 1;
     fSaveNames = 0;
+    fUseFast = 0;
+    fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nmach" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "nmacfvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'f':
+                fUseFast ^= 1;
+                break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
             case 'n':
                 fUseNewParser ^= 1;
                 break;
@@ -509,6 +528,8 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     // read the file using the corresponding file reader
     if ( fReadAsAig )
         pNtk = Io_ReadBlifAsAig( pFileName, fCheck );
+    else if ( fUseFast )
+        pNtk = Io_ReadBlifFast( pFileName, fCheck, fVerbose );
     else if ( fUseNewParser )
         pNtk = Io_Read( pFileName, IO_FILE_BLIF, fCheck, 0 );
     else
@@ -533,13 +554,15 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_blif [-nmach] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_blif [-nmacfvh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in binary BLIF format\n" );
     fprintf( pAbc->Err, "\t         (if this command does not work, try \"read\")\n" );
     fprintf( pAbc->Err, "\t-n     : toggle using old BLIF parser without hierarchy support [default = %s]\n", !fUseNewParser? "yes":"no" );
     fprintf( pAbc->Err, "\t-m     : toggle saving original circuit names into a file [default = %s]\n", fSaveNames? "yes":"no" );
     fprintf( pAbc->Err, "\t-a     : toggle creating AIG while reading the file [default = %s]\n", fReadAsAig? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
+    fprintf( pAbc->Err, "\t-f     : toggle using fast parser for large flat netlists [default = %s]\n", fUseFast? "yes":"no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing the reading speed [default = %s]\n", fVerbose? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
@@ -1175,17 +1198,29 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Abc_Ntk_t * pNtk;
     char * pFileName;
-    int fCheck, fBarBufs;
+    int fCheck, fBarBufs, nThreads;
     int c;
 
     fCheck = 1;
     fBarBufs = 0;
+    nThreads = 1;
     glo_fMapped = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "mcbh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pmcbh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads <= 0 )
+                    goto usage;
+                break;
             case 'm':
                 glo_fMapped ^= 1;
                 break;
@@ -1205,8 +1240,12 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
         goto usage;
     // get the input file name
     pFileName = argv[globalUtilOptind];
+    if ( nThreads > 1 && !glo_fMapped )
+        fprintf( pAbc->Out, "Warning: Only mapped Verilog (switch \"-m\") is read using several threads.\n" );
     // read the file using the corresponding file reader
+    glo_nThreads = nThreads;
     pNtk = Io_Read( pFileName, IO_FILE_VERILOG, fCheck, fBarBufs );
+    glo_nThreads = 1;
     if ( pNtk == NULL )
         return 1;
     // replace the current network
@@ -1215,8 +1254,9 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_verilog [-mcbh] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_verilog [-P num] [-mcbh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in Verilog (IWLS 2002/2005 subset)\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads used to read mapped Verilog [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-m     : toggle reading mapped Verilog [default = %s]\n", glo_fMapped? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
     fprintf( pAbc->Err, "\t-b     : toggle reading barrier buffers [default = %s]\n", fBarBufs? "yes":"no" );
@@ -1352,17 +1392,21 @@ usage:
 int IoCommandReadJson( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern Vec_Wec_t * Json_Read( char * pFileName, Abc_Nam_t ** ppStrs );
+    extern int Json_ReadNetlist( char * pFileName, Abc_Ntk_t ** ppNtk, Gia_Man_t ** ppGia );
     Vec_Wec_t * vObjs;
     Abc_Nam_t * pStrs;
     char * pFileName;
     FILE * pFile;
-    int c;
+    int c, fNetlist = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "nh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'n':
+                fNetlist ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -1383,6 +1427,23 @@ int IoCommandReadJson( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     fclose( pFile );
 
+    // read the netlist
+    if ( fNetlist )
+    {
+        Abc_Ntk_t * pNtk;
+        Gia_Man_t * pGia;
+        if ( !Json_ReadNetlist( pFileName, &pNtk, &pGia ) )
+            return 1;
+        if ( pGia )
+            Abc_FrameUpdateGia( pAbc, pGia );
+        if ( pNtk )
+        {
+            Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
+            Abc_FrameClearVerifStatus( pAbc );
+        }
+        return 0;
+    }
+
     // set the new network
     vObjs = Json_Read( pFileName, &pStrs );
     if ( vObjs == NULL )
@@ -1392,8 +1453,9 @@ int IoCommandReadJson( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_json [-h] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_json [-nh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads file in JSON format\n" );
+    fprintf( pAbc->Err, "\t-n     : toggle reading a netlist written by \"write_json -n\" or \"write_json -g\" [default = %s]\n", fNetlist? "yes": "no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
@@ -2060,19 +2122,32 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     int fFastAlgo;
     int fAllPrimes;
     int fChangePol;
+    int nThreads;
     int fVerbose;
-    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose );
+    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int nThreads, int fVerbose );
 
     fNewAlgo = 1;
     fFastAlgo = 0;
     fAllPrimes = 0;
     fChangePol = 1;
+    nThreads = 1;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nfpcvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnfpcvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads <= 0 )
+                    goto usage;
+                break;
             case 'n':
                 fNewAlgo ^= 1;
                 break;
@@ -2111,9 +2186,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     }
     // call the corresponding file writer
     if ( fFastAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, nThreads, fVerbose );
     else if ( fNewAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, nThreads, fVerbose );
     else if ( fAllPrimes )
         Io_WriteCnf( pAbc->pNtkCur, pFileName, 1 );
     else
@@ -2121,8 +2196,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_cnf [-nfpcvh] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_cnf [-P num] [-nfpcvh] <file>\n" );
     fprintf( pAbc->Err, "\t         generates CNF for the miter (see also \"&write_cnf\")\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads used to format the clauses [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-n     : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-f     : toggle using fast algorithm [default = %s]\n", fFastAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-p     : toggle using all primes to enhance implicativity [default = %s]\n", fAllPrimes? "yes" : "no" );
@@ -2146,17 +2222,18 @@ usage:
 ***********************************************************************/
 int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
 {
-    extern void Jf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int fVerbose );
-    extern void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int fVerbose );
+    extern void Jf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nThreads, int fVerbose );
+    extern void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int nThreads, int fVerbose );
     FILE * pFile;
     char * pFileName;
     int nLutSize    = 8;
     int fNewAlgo    = 1;
     int fCnfObjIds  = 0;
     int fAddOrCla   = 1;
+    int nThreads    = 1;
     int c, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Kaiovh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KPaiovh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -2169,6 +2246,17 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
                 nLutSize = atoi(argv[globalUtilOptind]);
                 globalUtilOptind++;
                 break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads <= 0 )
+                    goto usage;
+                break;
             case 'a':
                 fNewAlgo ^= 1;
                 break;
@@ -2219,15 +2307,16 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
     }
     fclose( pFile );
     if ( fNewAlgo )
-        Mf_ManDumpCnf( pAbc->pGia, pFileName, nLutSize, fCnfObjIds, fAddOrCla, fVerbose );
+        Mf_ManDumpCnf( pAbc->pGia, pFileName, nLutSize, fCnfObjIds, fAddOrCla, nThreads, fVerbose );
     else
-        Jf_ManDumpCnf( pAbc->pGia, pFileName, fVerbose );
+        Jf_ManDumpCnf( pAbc->pGia, pFileName, nThreads, fVerbose );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: &write_cnf [-Kaiovh] <file>\n" );
+    fprintf( pAbc->Err, "usage: &write_cnf [-KP num] [-aiovh] <file>\n" );
     fprintf( pAbc->Err, "\t           writes CNF produced by a new generator\n" );
     fprintf( pAbc->Err, "\t-K <num> : the LUT size (3 <= num <= 8) [default = %d]\n", nLutSize );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads used to format the clauses [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-a       : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-i       : toggle using AIG object IDs as CNF variables [default = %s]\n", fCnfObjIds? "yes" : "no" );
     fprintf( pAbc->Err, "\t-o       : toggle adding OR clause for the outputs [default = %s]\n", fAddOrCla? "yes" : "no" );
@@ -3189,20 +3278,62 @@ usage:
 int IoCommandWriteJson( Abc_Frame_t * pAbc, int argc, char **argv )
 {
     extern void Json_Write( char * pFileName, Abc_Nam_t * pStr, Vec_Wec_t * vObjs );
+    extern void Json_WriteGia( char * pFileName, Gia_Man_t * p );
+    extern void Json_WriteNtk( char * pFileName, Abc_Ntk_t * pNtk );
+    Abc_Ntk_t * pNtkTemp;
     char * pFileName;
-    int c;
+    int c, fNetlist = 0, fGia = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "ngh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'n':
+                fNetlist ^= 1;
+                break;
+            case 'g':
+                fGia ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
                 goto usage;
         }
     }
+    if ( fGia )
+    {
+        if ( pAbc->pGia == NULL )
+        {
+            fprintf( pAbc->Out, "There is no AIG.\n" );
+            return 0;
+        }
+        if ( argc != globalUtilOptind + 1 )
+            goto usage;
+        Json_WriteGia( argv[globalUtilOptind], pAbc->pGia );
+        return 0;
+    }
+    if ( fNetlist )
+    {
+        if ( pAbc->pNtkCur == NULL )
+        {
+            fprintf( pAbc->Out, "Empty network.\n" );
+            return 0;
+        }
+        if ( argc != globalUtilOptind + 1 )
+            goto usage;
+        pNtkTemp = Abc_NtkToNetlist( pAbc->pNtkCur );
+        if ( pNtkTemp == NULL )
+        {
+            fprintf( pAbc->Out, "Converting to netlist has failed.\n" );
+            return 0;
+        }
+        if ( !Abc_NtkHasSop(pNtkTemp) && !Abc_NtkHasMapping(pNtkTemp) )
+            Abc_NtkToSop( pNtkTemp, -1, ABC_INFINITY );
+        Json_WriteNtk( argv[globalUtilOptind], pNtkTemp );
+        Abc_NtkDelete( pNtkTemp );
+        return 0;
+    }
     if ( Abc_FrameReadJsonStrs(Abc_FrameReadGlobalFrame()) == NULL )
     {
         fprintf( pAbc->Out, "No JSON info is available.\n" );
@@ -3217,13 +3348,118 @@ int IoCommandWriteJson( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_json [-h] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_json [-ngh] <file>\n" );
     fprintf( pAbc->Err, "\t         write the network in JSON format\n" );
+    fprintf( pAbc->Err, "\t-n     : toggle writing the current network as a netlist [default = %s]\n", fNetlist? "yes": "no" );
+    fprintf( pAbc->Err, "\t-g     : toggle writing the AIG with its mapping as a netlist [default = %s]\n", fGia? "yes": "no" );
     fprintf( pAbc->Err, "\t-h     : print the help message\n" );
     fprintf( pAbc->Err, "\tfile   : the name of the file to write (extension .json)\n" );
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandSaveState( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    char * pFileName;
+    int c, fVerbose = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    // get the output file name
+    pFileName = argv[globalUtilOptind];
+    if ( !Io_WriteState( pAbc, pFileName, fVerbose ) )
+        return 1;
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: save_state [-vh] <file>\n" );
+    fprintf( pAbc->Err, "\t         saves the libraries, the current network and the current AIG\n" );
+    fprintf( pAbc->Err, "\t         into a binary snapshot, which can be restored by \"load_state\"\n" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandLoadState( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    FILE * pFile;
+    char * pFileName;
+    int c, fVerbose = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    // get the input file name
+    pFileName = argv[globalUtilOptind];
+    if ( (pFile = fopen( pFileName, "rb" )) == NULL )
+    {
+        fprintf( pAbc->Err, "Cannot open input file \"%s\". \n", pFileName );
+        return 1;
+    }
+    fclose( pFile );
+    if ( !Io_ReadState( pAbc, pFileName, fVerbose ) )
+        return 1;
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: load_state [-vh] <file>\n" );
+    fprintf( pAbc->Err, "\t         restores the libraries, the current network and the current AIG\n" );
+    fprintf( pAbc->Err, "\t         from the binary snapshot written by \"save_state\"\n" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to read\n" );
+    return 1;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
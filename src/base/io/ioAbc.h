@@ -86,6 +86,8 @@ extern Abc_Ntk_t *        Io_ReadBaf( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 /*=== abcReadBlif.c ===========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
+/*=== abcReadBlifFast.c =======================================================*/
+extern Abc_Ntk_t *        Io_ReadBlifFast( char * pFileName, int fCheck, int fVerbose );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
 /*=== abcReadBench.c ==========================================================*/
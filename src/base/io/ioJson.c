@@ -6,7 +6,7 @@
 
   PackageName [Command processing package.]
 
-  Synopsis    [Procedures to read JSON.]
+  Synopsis    [Procedures to read and write JSON.]
 
   Author      [Alan Mishchenko]
   
@@ -22,6 +22,9 @@
 #include "misc/vec/vecWec.h"
 #include "misc/util/utilNam.h"
 #include "misc/extra/extra.h"
+#include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "map/mio/mio.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -34,6 +37,104 @@ static inline int         Json_EntryIsName( int Fan )                     { retu
 static inline char *      Json_EntryName( Abc_Nam_t * pStrs, int Fan )    { assert(Json_EntryIsName(Fan));  return Abc_NamStr( pStrs, Abc_Lit2Var(Fan) );     }
 static inline Vec_Int_t * Json_EntryNode( Vec_Wec_t * vObjs, int Fan )    { assert(!Json_EntryIsName(Fan)); return Vec_WecEntry( vObjs, Abc_Lit2Var(Fan) );   }
 
+#define JSON_BUF_SIZE  (1 << 16)   // the size of the buffer for reading and writing
+#define JSON_DEPTH_MAX  64         // the largest nesting depth of the writer
+
+typedef struct Json_Wrt_t_ Json_Wrt_t;
+struct Json_Wrt_t_
+{
+    FILE *         pFile;          // the output file
+    char *         pBuffer;        // the output buffer
+    int            nBuffer;        // the number of characters in the buffer
+    int            nDepth;         // the number of open containers
+    int            fAfterKey;      // the key was written and the value is expected
+    char           pInline[JSON_DEPTH_MAX]; // the container is written on one line
+    char           pItems[JSON_DEPTH_MAX];  // the container has items
+};
+
+typedef enum {
+    JSON_EVENT_NONE = 0,           // 0: unused
+    JSON_EVENT_OBJ_BEG,            // 1: '{'
+    JSON_EVENT_OBJ_END,            // 2: '}'
+    JSON_EVENT_ARR_BEG,            // 3: '['
+    JSON_EVENT_ARR_END,            // 4: ']'
+    JSON_EVENT_KEY,                // 5: key of a pair
+    JSON_EVENT_STR,                // 6: string value
+    JSON_EVENT_NUM,                // 7: number value
+    JSON_EVENT_LIT                 // 8: true, false, or null
+} Json_Event_t;
+
+typedef int (*Json_SaxFunc_t)( void * pUser, int Event, char * pToken );
+
+typedef struct Json_Sax_t_ Json_Sax_t;
+struct Json_Sax_t_
+{
+    FILE *         pFile;          // the input file
+    char *         pBuffer;        // the input buffer
+    int            iBuffer;        // the current character in the buffer
+    int            nBuffer;        // the number of characters in the buffer
+    int            iLine;          // the current line
+    Vec_Str_t *    vToken;         // the current string or number
+    Vec_Str_t *    vStack;         // the open containers
+};
+
+typedef enum {
+    JSON_KEY_NONE = 0,             // 0: unused
+    JSON_KEY_NETLIST,              // 1: netlist kind
+    JSON_KEY_NAME,                 // 2: netlist or node name
+    JSON_KEY_OBJECTS,              // 3: the number of objects
+    JSON_KEY_REGS,                 // 4: the number of registers
+    JSON_KEY_FUNC,                 // 5: the function type of the nodes
+    JSON_KEY_OBJS,                 // 6: AIG objects
+    JSON_KEY_CINAMES,              // 7: AIG CI names
+    JSON_KEY_CONAMES,              // 8: AIG CO names
+    JSON_KEY_LUTS,                 // 9: AIG LUT mapping
+    JSON_KEY_CELLS,                // 10: AIG cell mapping
+    JSON_KEY_INPUTS,               // 11: network inputs
+    JSON_KEY_OUTPUTS,              // 12: network outputs
+    JSON_KEY_LATCHES,              // 13: network latches
+    JSON_KEY_NODES,                // 14: network nodes
+    JSON_KEY_FANINS,               // 15: node fanins
+    JSON_KEY_GATE,                 // 16: node gate
+    JSON_KEY_OUT,                  // 17: gate output
+    JSON_KEY_SOP,                  // 18: node SOP
+    JSON_KEY_UNKNOWN               // 19: unused
+} Json_Key_t;
+
+static char * s_JsonKeys[JSON_KEY_UNKNOWN] = { NULL, "netlist", "name", "objects", "regs", "func", "objs", "cinames", "conames", "luts", "cells", "inputs", "outputs", "latches", "nodes", "fanins", "gate", "out", "sop" };
+
+#define JSON_NTL_GIA   1
+#define JSON_NTL_ABC   2
+
+typedef struct Json_Ntl_t_ Json_Ntl_t;
+struct Json_Ntl_t_
+{
+    int            Kind;           // netlist kind (JSON_NTL_GIA or JSON_NTL_ABC)
+    int            nDepth;         // the current nesting depth
+    int            Section;        // the current key of the top-level object
+    int            NodeKey;        // the current key of the node
+    int            nObjsHint;      // the expected number of AIG objects
+    int            nRegs;          // the number of registers
+    int            fMap;           // the nodes are mapped
+    char *         pName;          // netlist name
+    Gia_Man_t *    pGia;           // the AIG being read
+    Abc_Ntk_t *    pNtk;           // the netlist being read
+    Vec_Int_t *    vRec;           // offsets of the strings of the current record
+    Vec_Str_t *    vStr;           // strings of the current record
+    Vec_Int_t *    vLuts;          // LUT mapping records
+    Vec_Int_t *    vCells;         // cell mapping records
+    Vec_Ptr_t *    vNamesIn;       // CI names
+    Vec_Ptr_t *    vNamesOut;      // CO names
+    char *         pNodeName;      // node name
+    char *         pNodeGate;      // node gate
+    char *         pNodeOut;       // node gate output
+    char *         pNodeSop;       // node SOP
+};
+
+static inline void Json_WrtFlush( Json_Wrt_t * p )           { fwrite( p->pBuffer, 1, p->nBuffer, p->pFile ); p->nBuffer = 0;           }
+static inline void Json_WrtChar( Json_Wrt_t * p, char c )    { if ( p->nBuffer == JSON_BUF_SIZE ) Json_WrtFlush(p); p->pBuffer[p->nBuffer++] = c; }
+static inline void Json_WrtChars( Json_Wrt_t * p, char * s ) { while ( *s ) Json_WrtChar( p, *s++ );                                      }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -261,6 +362,1102 @@ void Json_ReadTest( char * pFileName )
     Vec_WecFree( vObjs );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Streaming JSON writer.]
+
+  Description [The writer keeps only the output buffer and the state of
+  the open containers, so its memory does not depend on the size of
+  the data. Containers opened with fInline set are written on one line.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Json_Wrt_t * Json_WrtStart( char * pFileName )
+{
+    Json_Wrt_t * p;
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        return NULL;
+    }
+    p = ABC_CALLOC( Json_Wrt_t, 1 );
+    p->pFile   = pFile;
+    p->pBuffer = ABC_ALLOC( char, JSON_BUF_SIZE );
+    return p;
+}
+void Json_WrtStop( Json_Wrt_t * p )
+{
+    assert( p->nDepth == 0 );
+    Json_WrtChar( p, '\n' );
+    Json_WrtFlush( p );
+    fclose( p->pFile );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+}
+static void Json_WrtItem( Json_Wrt_t * p )
+{
+    int i;
+    if ( p->fAfterKey )
+    {
+        p->fAfterKey = 0;
+        return;
+    }
+    if ( p->nDepth == 0 )
+        return;
+    if ( p->pItems[p->nDepth] )
+        Json_WrtChar( p, ',' );
+    if ( !p->pInline[p->nDepth] )
+    {
+        Json_WrtChar( p, '\n' );
+        for ( i = 0; i < 3*p->nDepth; i++ )
+            Json_WrtChar( p, ' ' );
+    }
+    else if ( p->pItems[p->nDepth] )
+        Json_WrtChar( p, ' ' );
+    p->pItems[p->nDepth] = 1;
+}
+static void Json_WrtBegin( Json_Wrt_t * p, char c, int fInline )
+{
+    Json_WrtItem( p );
+    Json_WrtChar( p, c );
+    assert( p->nDepth + 1 < JSON_DEPTH_MAX );
+    p->nDepth++;
+    p->pInline[p->nDepth] = (char)(fInline || p->pInline[p->nDepth-1]);
+    p->pItems[p->nDepth]  = 0;
+}
+static void Json_WrtEnd( Json_Wrt_t * p, char c )
+{
+    int i;
+    assert( p->nDepth > 0 && !p->fAfterKey );
+    if ( !p->pInline[p->nDepth] && p->pItems[p->nDepth] )
+    {
+        Json_WrtChar( p, '\n' );
+        for ( i = 0; i < 3*(p->nDepth-1); i++ )
+            Json_WrtChar( p, ' ' );
+    }
+    p->nDepth--;
+    Json_WrtChar( p, c );
+}
+void Json_WrtObjBegin( Json_Wrt_t * p, int fInline ) { Json_WrtBegin( p, '{', fInline ); }
+void Json_WrtObjEnd( Json_Wrt_t * p )                { Json_WrtEnd( p, '}' );             }
+void Json_WrtArrBegin( Json_Wrt_t * p, int fInline ) { Json_WrtBegin( p, '[', fInline ); }
+void Json_WrtArrEnd( Json_Wrt_t * p )                { Json_WrtEnd( p, ']' );             }
+static void Json_WrtQuoted( Json_Wrt_t * p, char * pStr )
+{
+    static char * pHex = "0123456789abcdef";
+    Json_WrtChar( p, '\"' );
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            Json_WrtChar( p, '\\' ), Json_WrtChar( p, *pStr );
+        else if ( *pStr == '\n' )
+            Json_WrtChar( p, '\\' ), Json_WrtChar( p, 'n' );
+        else if ( *pStr == '\t' )
+            Json_WrtChar( p, '\\' ), Json_WrtChar( p, 't' );
+        else if ( (unsigned char)*pStr < 0x20 )
+        {
+            Json_WrtChars( p, "\\u00" );
+            Json_WrtChar( p, pHex[(*pStr >> 4) & 0xF] );
+            Json_WrtChar( p, pHex[*pStr & 0xF] );
+        }
+        else
+            Json_WrtChar( p, *pStr );
+    }
+    Json_WrtChar( p, '\"' );
+}
+void Json_WrtKey( Json_Wrt_t * p, char * pKey )
+{
+    assert( !p->fAfterKey );
+    Json_WrtItem( p );
+    Json_WrtQuoted( p, pKey );
+    Json_WrtChars( p, " : " );
+    p->fAfterKey = 1;
+}
+void Json_WrtStr( Json_Wrt_t * p, char * pStr )
+{
+    Json_WrtItem( p );
+    Json_WrtQuoted( p, pStr );
+}
+void Json_WrtInt( Json_Wrt_t * p, int Num )
+{
+    char Digits[16];
+    unsigned Value = Num < 0 ? 0 - (unsigned)Num : (unsigned)Num;
+    int i = 0;
+    Json_WrtItem( p );
+    if ( Num < 0 )
+        Json_WrtChar( p, '-' );
+    do Digits[i++] = (char)('0' + Value % 10); while ( (Value /= 10) );
+    while ( i )
+        Json_WrtChar( p, Digits[--i] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG with its mapping as a JSON netlist.]
+
+  Description [Objects are listed in the order of their IDs, starting
+  from 1 (object 0 is constant 0), and fanins are given as literals.
+  LUT mapping lists the root and the fanin IDs of each LUT. Cell mapping
+  lists the literal, the cell ID (-1 for inverter, -2 for buffer), and
+  the fanin literals of each cell.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Json_WriteGia( char * pFileName, Gia_Man_t * p )
+{
+    Json_Wrt_t * pWrt;
+    Gia_Obj_t * pObj;
+    char * pName;
+    int i, k, iFan;
+    if ( (pWrt = Json_WrtStart( pFileName )) == NULL )
+        return;
+    Json_WrtObjBegin( pWrt, 0 );
+    Json_WrtKey( pWrt, "netlist" ); Json_WrtStr( pWrt, "gia" );
+    Json_WrtKey( pWrt, "name" );    Json_WrtStr( pWrt, p->pName ? p->pName : "" );
+    Json_WrtKey( pWrt, "objects" ); Json_WrtInt( pWrt, Gia_ManObjNum(p) );
+    Json_WrtKey( pWrt, "regs" );    Json_WrtInt( pWrt, Gia_ManRegNum(p) );
+    Json_WrtKey( pWrt, "objs" );
+    Json_WrtArrBegin( pWrt, 0 );
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        Json_WrtArrBegin( pWrt, 1 );
+        if ( Gia_ObjIsCi(pObj) )
+            Json_WrtStr( pWrt, "ci" );
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            Json_WrtStr( pWrt, "co" );
+            Json_WrtInt( pWrt, Gia_ObjFaninLit0p(p, pObj) );
+        }
+        else if ( Gia_ObjIsMuxId(p, i) )
+        {
+            Json_WrtStr( pWrt, "mux" );
+            Json_WrtInt( pWrt, Gia_ObjFaninLit2p(p, pObj) );
+            Json_WrtInt( pWrt, Gia_ObjFaninLit1p(p, pObj) );
+            Json_WrtInt( pWrt, Gia_ObjFaninLit0p(p, pObj) );
+        }
+        else if ( Gia_ObjIsBuf(pObj) )
+        {
+            Json_WrtStr( pWrt, "buf" );
+            Json_WrtInt( pWrt, Gia_ObjFaninLit0p(p, pObj) );
+        }
+        else
+        {
+            Json_WrtStr( pWrt, Gia_ObjIsXor(pObj) ? "xor" : "and" );
+            Json_WrtInt( pWrt, Gia_ObjFaninLit0p(p, pObj) );
+            Json_WrtInt( pWrt, Gia_ObjFaninLit1p(p, pObj) );
+        }
+        Json_WrtArrEnd( pWrt );
+    }
+    Json_WrtArrEnd( pWrt );
+    if ( p->vNamesIn )
+    {
+        Json_WrtKey( pWrt, "cinames" );
+        Json_WrtArrBegin( pWrt, 0 );
+        Vec_PtrForEachEntry( char *, p->vNamesIn, pName, i )
+            Json_WrtStr( pWrt, pName );
+        Json_WrtArrEnd( pWrt );
+    }
+    if ( p->vNamesOut )
+    {
+        Json_WrtKey( pWrt, "conames" );
+        Json_WrtArrBegin( pWrt, 0 );
+        Vec_PtrForEachEntry( char *, p->vNamesOut, pName, i )
+            Json_WrtStr( pWrt, pName );
+        Json_WrtArrEnd( pWrt );
+    }
+    if ( Gia_ManHasMapping(p) )
+    {
+        Json_WrtKey( pWrt, "luts" );
+        Json_WrtArrBegin( pWrt, 0 );
+        Gia_ManForEachLut( p, i )
+        {
+            Json_WrtArrBegin( pWrt, 1 );
+            Json_WrtInt( pWrt, i );
+            Gia_LutForEachFanin( p, i, iFan, k )
+                Json_WrtInt( pWrt, iFan );
+            Json_WrtArrEnd( pWrt );
+        }
+        Json_WrtArrEnd( pWrt );
+    }
+    if ( Gia_ManHasCellMapping(p) )
+    {
+        Json_WrtKey( pWrt, "cells" );
+        Json_WrtArrBegin( pWrt, 0 );
+        Gia_ManForEachCell( p, i )
+        {
+            Json_WrtArrBegin( pWrt, 1 );
+            Json_WrtInt( pWrt, i );
+            if ( Gia_ObjIsCellInv(p, i) || Gia_ObjIsCellBuf(p, i) )
+                Json_WrtInt( pWrt, Vec_IntEntry(p->vCellMapping, i) );
+            else
+            {
+                Json_WrtInt( pWrt, Gia_ObjCellId(p, i) );
+                Gia_CellForEachFanin( p, i, iFan, k )
+                    Json_WrtInt( pWrt, iFan );
+            }
+            Json_WrtArrEnd( pWrt );
+        }
+        Json_WrtArrEnd( pWrt );
+    }
+    Json_WrtObjEnd( pWrt );
+    Json_WrtStop( pWrt );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the netlist in JSON format.]
+
+  Description [Nodes of a mapped netlist refer to the gates of the
+  current library; nodes of other netlists are written as SOPs. All
+  objects are named by their nets. Each latch lists its output, its
+  input, and the initial value (0, 1, or 2 for don't-care). The reader
+  also accepts an output given as a pair of its name and its driver.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Json_WriteNtk( char * pFileName, Abc_Ntk_t * pNtk )
+{
+    Json_Wrt_t * pWrt;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k;
+    assert( Abc_NtkIsNetlist(pNtk) && (Abc_NtkHasSop(pNtk) || Abc_NtkHasMapping(pNtk)) );
+    if ( (pWrt = Json_WrtStart( pFileName )) == NULL )
+        return;
+    Json_WrtObjBegin( pWrt, 0 );
+    Json_WrtKey( pWrt, "netlist" ); Json_WrtStr( pWrt, "abc" );
+    Json_WrtKey( pWrt, "name" );    Json_WrtStr( pWrt, Abc_NtkName(pNtk) ? Abc_NtkName(pNtk) : "" );
+    Json_WrtKey( pWrt, "func" );    Json_WrtStr( pWrt, Abc_NtkHasMapping(pNtk) ? "map" : "sop" );
+    Json_WrtKey( pWrt, "inputs" );
+    Json_WrtArrBegin( pWrt, 0 );
+    Abc_NtkForEachPi( pNtk, pObj, i )
+        Json_WrtStr( pWrt, Abc_ObjName(Abc_ObjFanout0(pObj)) );
+    Json_WrtArrEnd( pWrt );
+    Json_WrtKey( pWrt, "outputs" );
+    Json_WrtArrBegin( pWrt, 0 );
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Json_WrtStr( pWrt, Abc_ObjName(Abc_ObjFanin0(pObj)) );
+    Json_WrtArrEnd( pWrt );
+    Json_WrtKey( pWrt, "latches" );
+    Json_WrtArrBegin( pWrt, 0 );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+    {
+        Json_WrtArrBegin( pWrt, 1 );
+        Json_WrtStr( pWrt, Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pObj))) );
+        Json_WrtStr( pWrt, Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pObj))) );
+        Json_WrtInt( pWrt, Abc_LatchIsInit0(pObj) ? 0 : Abc_LatchIsInit1(pObj) ? 1 : 2 );
+        Json_WrtArrEnd( pWrt );
+    }
+    Json_WrtArrEnd( pWrt );
+    Json_WrtKey( pWrt, "nodes" );
+    Json_WrtArrBegin( pWrt, 0 );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        Json_WrtObjBegin( pWrt, 1 );
+        Json_WrtKey( pWrt, "name" );
+        Json_WrtStr( pWrt, Abc_ObjName(Abc_ObjFanout0(pObj)) );
+        Json_WrtKey( pWrt, "fanins" );
+        Json_WrtArrBegin( pWrt, 1 );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Json_WrtStr( pWrt, Abc_ObjName(pFanin) );
+        Json_WrtArrEnd( pWrt );
+        if ( Abc_NtkHasMapping(pNtk) )
+        {
+            Json_WrtKey( pWrt, "gate" );
+            Json_WrtStr( pWrt, Mio_GateReadName((Mio_Gate_t *)pObj->pData) );
+            if ( Mio_GateReadTwin((Mio_Gate_t *)pObj->pData) )
+            {
+                Json_WrtKey( pWrt, "out" );
+                Json_WrtStr( pWrt, Mio_GateReadOutName((Mio_Gate_t *)pObj->pData) );
+            }
+        }
+        else
+        {
+            Json_WrtKey( pWrt, "sop" );
+            Json_WrtStr( pWrt, (char *)pObj->pData );
+        }
+        Json_WrtObjEnd( pWrt );
+    }
+    Json_WrtArrEnd( pWrt );
+    Json_WrtObjEnd( pWrt );
+    Json_WrtStop( pWrt );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [SAX-style JSON parser.]
+
+  Description [Reads the file through a fixed-size buffer and reports
+  each syntactic element to the callback, which returns 0 to continue
+  and 1 to stop. The memory used by the parser is bounded by the buffer,
+  the longest string, and the nesting depth. Returns 1 on success.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Json_SaxGetc( Json_Sax_t * p )
+{
+    if ( p->iBuffer == p->nBuffer )
+    {
+        p->nBuffer = fread( p->pBuffer, 1, JSON_BUF_SIZE, p->pFile );
+        p->iBuffer = 0;
+        if ( p->nBuffer == 0 )
+            return -1;
+    }
+    if ( p->pBuffer[p->iBuffer] == '\n' )
+        p->iLine++;
+    return (unsigned char)p->pBuffer[p->iBuffer++];
+}
+static inline void Json_SaxUngetc( Json_Sax_t * p )
+{
+    assert( p->iBuffer > 0 );
+    if ( p->pBuffer[--p->iBuffer] == '\n' )
+        p->iLine--;
+}
+static void Json_SaxPushUtf8( Vec_Str_t * vStr, unsigned Code )
+{
+    if ( Code < 0x80 )
+        Vec_StrPush( vStr, (char)Code );
+    else if ( Code < 0x800 )
+    {
+        Vec_StrPush( vStr, (char)(0xC0 | (Code >> 6)) );
+        Vec_StrPush( vStr, (char)(0x80 | (Code & 0x3F)) );
+    }
+    else
+    {
+        Vec_StrPush( vStr, (char)(0xE0 | (Code >> 12)) );
+        Vec_StrPush( vStr, (char)(0x80 | ((Code >> 6) & 0x3F)) );
+        Vec_StrPush( vStr, (char)(0x80 | (Code & 0x3F)) );
+    }
+}
+static int Json_SaxReadString( Json_Sax_t * p )
+{
+    unsigned Code;
+    int c, i;
+    Vec_StrClear( p->vToken );
+    while ( (c = Json_SaxGetc(p)) != '\"' )
+    {
+        if ( c == -1 || c == '\n' )
+            return 0;
+        if ( c != '\\' )
+        {
+            Vec_StrPush( p->vToken, (char)c );
+            continue;
+        }
+        c = Json_SaxGetc( p );
+        if ( c == 'n' )
+            Vec_StrPush( p->vToken, '\n' );
+        else if ( c == 't' )
+            Vec_StrPush( p->vToken, '\t' );
+        else if ( c == 'r' )
+            Vec_StrPush( p->vToken, '\r' );
+        else if ( c == 'b' )
+            Vec_StrPush( p->vToken, '\b' );
+        else if ( c == 'f' )
+            Vec_StrPush( p->vToken, '\f' );
+        else if ( c == '\"' || c == '\\' || c == '/' )
+            Vec_StrPush( p->vToken, (char)c );
+        else if ( c == 'u' )
+        {
+            for ( Code = i = 0; i < 4; i++ )
+            {
+                c = Json_SaxGetc( p );
+                if ( c >= '0' && c <= '9' )
+                    Code = 16 * Code + (c - '0');
+                else if ( c >= 'a' && c <= 'f' )
+                    Code = 16 * Code + (c - 'a' + 10);
+                else if ( c >= 'A' && c <= 'F' )
+                    Code = 16 * Code + (c - 'A' + 10);
+                else
+                    return 0;
+            }
+            Json_SaxPushUtf8( p->vToken, Code );
+        }
+        else
+            return 0;
+    }
+    Vec_StrPush( p->vToken, '\0' );
+    return 1;
+}
+static void Json_SaxReadWord( Json_Sax_t * p, int c, int fNumber )
+{
+    Vec_StrClear( p->vToken );
+    while ( c != -1 && (fNumber ? ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') : (c >= 'a' && c <= 'z')) )
+    {
+        Vec_StrPush( p->vToken, (char)c );
+        c = Json_SaxGetc( p );
+    }
+    if ( c != -1 )
+        Json_SaxUngetc( p );
+    Vec_StrPush( p->vToken, '\0' );
+}
+int Json_SaxParse( char * pFileName, Json_SaxFunc_t pFunc, void * pUser )
+{
+    enum { JSON_EXP_VALUE, JSON_EXP_VALUE_END, JSON_EXP_KEY, JSON_EXP_KEY_END, JSON_EXP_COLON, JSON_EXP_NEXT, JSON_EXP_DONE };
+    Json_Sax_t Sax, * p = &Sax;
+    char * pError = NULL;
+    int c, Event, State = JSON_EXP_VALUE, RetValue = 0;
+    memset( p, 0, sizeof(Json_Sax_t) );
+    p->pFile = fopen( pFileName, "rb" );
+    if ( p->pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return 0;
+    }
+    p->pBuffer = ABC_ALLOC( char, JSON_BUF_SIZE );
+    p->vToken  = Vec_StrAlloc( 100 );
+    p->vStack  = Vec_StrAlloc( 100 );
+    p->iLine   = 1;
+    while ( 1 )
+    {
+        do c = Json_SaxGetc( p ); while ( Json_CharIsSpace((char)c) );
+        if ( c == -1 )
+        {
+            if ( State == JSON_EXP_DONE )
+                RetValue = 1;
+            else
+                pError = "Unexpected end of file";
+            break;
+        }
+        if ( State == JSON_EXP_DONE )
+        {
+            pError = "Extra characters after the end of data";
+            break;
+        }
+        if ( State == JSON_EXP_COLON )
+        {
+            if ( c != ':' )
+            {
+                pError = "Expecting \':\'";
+                break;
+            }
+            State = JSON_EXP_VALUE;
+            continue;
+        }
+        if ( State == JSON_EXP_NEXT && c == ',' )
+        {
+            State = Vec_StrEntryLast(p->vStack) == '{' ? JSON_EXP_KEY : JSON_EXP_VALUE;
+            continue;
+        }
+        if ( (c == '}' && (State == JSON_EXP_NEXT || State == JSON_EXP_KEY_END)) || (c == ']' && (State == JSON_EXP_NEXT || State == JSON_EXP_VALUE_END)) )
+        {
+            if ( Vec_StrPop(p->vStack) != (c == '}' ? '{' : '[') )
+            {
+                pError = "Mismatched closing bracket";
+                break;
+            }
+            if ( pFunc( pUser, c == '}' ? JSON_EVENT_OBJ_END : JSON_EVENT_ARR_END, NULL ) )
+                break;
+            State = Vec_StrSize(p->vStack) ? JSON_EXP_NEXT : JSON_EXP_DONE;
+            continue;
+        }
+        if ( State == JSON_EXP_KEY || State == JSON_EXP_KEY_END )
+        {
+            if ( c != '\"' || !Json_SaxReadString(p) )
+            {
+                pError = "Expecting a key";
+                break;
+            }
+            if ( pFunc( pUser, JSON_EVENT_KEY, Vec_StrArray(p->vToken) ) )
+                break;
+            State = JSON_EXP_COLON;
+            continue;
+        }
+        if ( State == JSON_EXP_NEXT )
+        {
+            pError = "Expecting \',\' or a closing bracket";
+            break;
+        }
+        // a value is expected
+        if ( c == '{' || c == '[' )
+        {
+            Vec_StrPush( p->vStack, (char)c );
+            if ( pFunc( pUser, c == '{' ? JSON_EVENT_OBJ_BEG : JSON_EVENT_ARR_BEG, NULL ) )
+                break;
+            State = c == '{' ? JSON_EXP_KEY_END : JSON_EXP_VALUE_END;
+            continue;
+        }
+        if ( c == '\"' )
+        {
+            if ( !Json_SaxReadString(p) )
+            {
+                pError = "Unterminated string";
+                break;
+            }
+            Event = JSON_EVENT_STR;
+        }
+        else if ( c == '-' || (c >= '0' && c <= '9') )
+        {
+            Json_SaxReadWord( p, c, 1 );
+            Event = JSON_EVENT_NUM;
+        }
+        else if ( c >= 'a' && c <= 'z' )
+        {
+            Json_SaxReadWord( p, c, 0 );
+            if ( strcmp(Vec_StrArray(p->vToken), "true") && strcmp(Vec_StrArray(p->vToken), "false") && strcmp(Vec_StrArray(p->vToken), "null") )
+            {
+                pError = "Unknown literal";
+                break;
+            }
+            Event = JSON_EVENT_LIT;
+        }
+        else
+        {
+            pError = "Unexpected character";
+            break;
+        }
+        if ( pFunc( pUser, Event, Vec_StrArray(p->vToken) ) )
+            break;
+        State = Vec_StrSize(p->vStack) ? JSON_EXP_NEXT : JSON_EXP_DONE;
+    }
+    if ( pError )
+        printf( "Json_SaxParse(): %s in line %d of file \"%s\".\n", pError, p->iLine, pFileName );
+    else if ( !RetValue )
+        printf( "Json_SaxParse(): Reading stopped in line %d of file \"%s\".\n", p->iLine, pFileName );
+    fclose( p->pFile );
+    ABC_FREE( p->pBuffer );
+    Vec_StrFree( p->vToken );
+    Vec_StrFree( p->vStack );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading JSON netlists.]
+
+  Description [The netlist is built while the file is parsed. The top
+  level is an object whose "netlist" entry ("gia" or "abc") should come
+  before the data; its arrays contain one record per object. Depth 1 is
+  the top-level object, depth 2 is a section, depth 3 is a record, and
+  depth 4 is the list of fanins of a node.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Json_NtlKeyFind( char * pKey )
+{
+    int i;
+    for ( i = 1; i < JSON_KEY_UNKNOWN; i++ )
+        if ( !strcmp(s_JsonKeys[i], pKey) )
+            return i;
+    return JSON_KEY_UNKNOWN;
+}
+static int Json_NtlStrInt( char * pStr, int * pValue )
+{
+    char * pEnd;
+    long Value = strtol( pStr, &pEnd, 10 );
+    if ( pEnd == pStr || *pEnd || Value != (long)(int)Value )
+    {
+        printf( "Token \"%s\" is not a valid integer.\n", pStr );
+        return 0;
+    }
+    *pValue = (int)Value;
+    return 1;
+}
+static inline char * Json_NtlRecStr( Json_Ntl_t * p, int i )               { return Vec_StrEntryP( p->vStr, Vec_IntEntry(p->vRec, i) ); }
+static inline int    Json_NtlRecInt( Json_Ntl_t * p, int i, int * pValue ) { return Json_NtlStrInt( Json_NtlRecStr(p, i), pValue );      }
+static inline int    Json_NtlRecNum( Json_Ntl_t * p )                      { return Vec_IntSize( p->vRec );                                }
+static int Json_NtlLitCheck( Json_Ntl_t * p, int iLit )
+{
+    if ( iLit >= 0 && Abc_Lit2Var(iLit) < Gia_ManObjNum(p->pGia) && !Gia_ObjIsCo(Gia_ManObj(p->pGia, Abc_Lit2Var(iLit))) )
+        return 1;
+    printf( "Literal %d of object %d is not valid.\n", iLit, Gia_ManObjNum(p->pGia) );
+    return 0;
+}
+static int Json_NtlAddGiaObj( Json_Ntl_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    char * pType = Json_NtlRecNum(p) ? Json_NtlRecStr(p, 0) : "";
+    int i, nArgs = !strcmp(pType, "ci") ? 0 : !strcmp(pType, "co") || !strcmp(pType, "buf") ? 1 : !strcmp(pType, "mux") ? 3 : 2;
+    int pLits[3];
+    if ( Json_NtlRecNum(p) != nArgs + 1 || (nArgs == 2 && strcmp(pType, "and") && strcmp(pType, "xor")) )
+    {
+        printf( "Object %d has unknown type or wrong number of fanins.\n", Gia_ManObjNum(pGia) );
+        return 1;
+    }
+    for ( i = 0; i < nArgs; i++ )
+        if ( !Json_NtlRecInt( p, i+1, pLits+i ) || !Json_NtlLitCheck( p, pLits[i] ) )
+            return 1;
+    if ( nArgs == 0 )
+        Gia_ManAppendCi( pGia );
+    else if ( !strcmp(pType, "co") )
+        Gia_ManAppendCo( pGia, pLits[0] );
+    else if ( nArgs == 1 )
+        Gia_ManAppendBuf( pGia, pLits[0] );
+    else if ( nArgs == 2 && Abc_Lit2Var(pLits[0]) == Abc_Lit2Var(pLits[1]) )
+    {
+        printf( "Object %d has the same fanin twice.\n", Gia_ManObjNum(pGia) );
+        return 1;
+    }
+    else if ( !strcmp(pType, "and") )
+        Gia_ManAppendAnd( pGia, pLits[0], pLits[1] );
+    else if ( !strcmp(pType, "xor") )
+    {
+        if ( Abc_LitIsCompl(pLits[0]) || Abc_LitIsCompl(pLits[1]) )
+        {
+            printf( "XOR object %d has complemented fanins.\n", Gia_ManObjNum(pGia) );
+            return 1;
+        }
+        Gia_ManAppendXorReal( pGia, pLits[0], pLits[1] );
+    }
+    else
+    {
+        if ( Abc_Lit2Var(pLits[0]) == Abc_Lit2Var(pLits[1]) || Abc_Lit2Var(pLits[0]) == Abc_Lit2Var(pLits[2]) || Abc_Lit2Var(pLits[1]) == Abc_Lit2Var(pLits[2]) )
+        {
+            printf( "MUX object %d has repeated fanins.\n", Gia_ManObjNum(pGia) );
+            return 1;
+        }
+        if ( pGia->pMuxes == NULL )
+            pGia->pMuxes = ABC_CALLOC( unsigned, pGia->nObjsAlloc );
+        Gia_ManAppendMuxReal( pGia, pLits[0], pLits[1], pLits[2] );
+    }
+    return 0;
+}
+static int Json_NtlAddMapping( Json_Ntl_t * p, Vec_Int_t * vStore )
+{
+    int i, Value;
+    if ( Json_NtlRecNum(p) < 2 )
+    {
+        printf( "Mapping record with %d entries is not valid.\n", Json_NtlRecNum(p) );
+        return 1;
+    }
+    Vec_IntPush( vStore, Json_NtlRecNum(p) );
+    for ( i = 0; i < Json_NtlRecNum(p); i++ )
+    {
+        if ( !Json_NtlRecInt( p, i, &Value ) )
+            return 1;
+        Vec_IntPush( vStore, Value );
+    }
+    return 0;
+}
+static int Json_NtlAddNode( Json_Ntl_t * p )
+{
+    Abc_Ntk_t * pNtk = p->pNtk;
+    Abc_Obj_t * pNode;
+    char ** ppNames;
+    int i, nFanins = Json_NtlRecNum(p);
+    if ( p->pNodeName == NULL || (p->fMap ? p->pNodeGate == NULL : p->pNodeSop == NULL) )
+    {
+        printf( "Node %d does not have a name or a function.\n", Abc_NtkNodeNum(pNtk) );
+        return 1;
+    }
+    ppNames = ABC_ALLOC( char *, nFanins + 1 );
+    for ( i = 0; i < nFanins; i++ )
+        ppNames[i] = Json_NtlRecStr( p, i );
+    pNode = Io_ReadCreateNode( pNtk, p->pNodeName, ppNames, nFanins );
+    ABC_FREE( ppNames );
+    if ( p->fMap )
+    {
+        Mio_Gate_t * pGate = Mio_LibraryReadGateByName( (Mio_Library_t *)pNtk->pManFunc, p->pNodeGate, p->pNodeOut );
+        if ( pGate == NULL )
+        {
+            printf( "Cannot find gate \"%s\" in the library.\n", p->pNodeGate );
+            return 1;
+        }
+        if ( Mio_GateReadPinNum(pGate) != nFanins )
+        {
+            printf( "Gate \"%s\" of node \"%s\" has %d inputs but the node has %d fanins.\n", p->pNodeGate, p->pNodeName, Mio_GateReadPinNum(pGate), nFanins );
+            return 1;
+        }
+        Abc_ObjSetData( pNode, pGate );
+    }
+    else
+    {
+        if ( Abc_SopGetVarNum(p->pNodeSop) != nFanins )
+        {
+            printf( "The SOP of node \"%s\" has %d variables but the node has %d fanins.\n", p->pNodeName, Abc_SopGetVarNum(p->pNodeSop), nFanins );
+            return 1;
+        }
+        Abc_ObjSetData( pNode, Abc_SopRegister((Mem_Flex_t *)pNtk->pManFunc, p->pNodeSop) );
+    }
+    return 0;
+}
+static int Json_NtlAddOutput( Json_Ntl_t * p, char * pName, char * pDriver )
+{
+    Abc_Obj_t * pNode;
+    Io_ReadCreatePo( p->pNtk, pName );
+    if ( !strcmp(pName, pDriver) )
+        return 0;
+    pNode = Io_ReadCreateNode( p->pNtk, pName, &pDriver, 1 );
+    if ( p->fMap )
+        Abc_ObjSetData( pNode, Mio_LibraryReadBuf((Mio_Library_t *)p->pNtk->pManFunc) );
+    else
+        Abc_ObjSetData( pNode, Abc_SopCreateBuf((Mem_Flex_t *)p->pNtk->pManFunc) );
+    return 0;
+}
+static int Json_NtlAddLatch( Json_Ntl_t * p )
+{
+    Abc_Obj_t * pLatch;
+    int Init = 2;
+    if ( Json_NtlRecNum(p) < 2 || Json_NtlRecNum(p) > 3 )
+    {
+        printf( "Latch %d should have the output, the input, and the initial value.\n", Abc_NtkLatchNum(p->pNtk) );
+        return 1;
+    }
+    if ( Json_NtlRecNum(p) == 3 && (!Json_NtlRecInt(p, 2, &Init) || Init < 0 || Init > 2) )
+    {
+        printf( "Latch %d has initial value \"%s\" instead of 0, 1, or 2.\n", Abc_NtkLatchNum(p->pNtk), Json_NtlRecStr(p, 2) );
+        return 1;
+    }
+    pLatch = Io_ReadCreateLatch( p->pNtk, Json_NtlRecStr(p, 1), Json_NtlRecStr(p, 0) );
+    if ( Init == 0 )
+        Abc_LatchSetInit0( pLatch );
+    else if ( Init == 1 )
+        Abc_LatchSetInit1( pLatch );
+    else
+        Abc_LatchSetInitDc( pLatch );
+    return 0;
+}
+static int Json_NtlStartKind( Json_Ntl_t * p, char * pKind )
+{
+    if ( p->Kind )
+    {
+        printf( "The netlist kind is given more than once.\n" );
+        return 1;
+    }
+    if ( !strcmp(pKind, "gia") )
+    {
+        p->Kind = JSON_NTL_GIA;
+        // the hint only presizes the manager, which grows as needed
+        p->pGia = Gia_ManStart( Abc_MinInt(Abc_MaxInt(p->nObjsHint, 1000), 1 << 20) );
+    }
+    else if ( !strcmp(pKind, "abc") )
+    {
+        p->Kind = JSON_NTL_ABC;
+        p->pNtk = Abc_NtkAlloc( ABC_NTK_NETLIST, ABC_FUNC_SOP, 1 );
+    }
+    else
+    {
+        printf( "Unknown netlist kind \"%s\".\n", pKind );
+        return 1;
+    }
+    return 0;
+}
+static int Json_NtlStartMapped( Json_Ntl_t * p, char * pFunc )
+{
+    Mio_Library_t * pLib = (Mio_Library_t *)Abc_FrameReadLibGen();
+    if ( p->Kind != JSON_NTL_ABC || Abc_NtkNodeNum(p->pNtk) > 0 || Abc_NtkPoNum(p->pNtk) > 0 )
+    {
+        printf( "The function type should follow the netlist kind \"abc\" and precede the data.\n" );
+        return 1;
+    }
+    if ( strcmp(pFunc, "map") )
+        return 0;
+    if ( pLib == NULL )
+    {
+        printf( "The current library is not available.\n" );
+        return 1;
+    }
+    p->fMap = 1;
+    p->pNtk->ntkFunc = ABC_FUNC_MAP;
+    Mem_FlexStop( (Mem_Flex_t *)p->pNtk->pManFunc, 0 );
+    p->pNtk->pManFunc = pLib;
+    return 0;
+}
+static int Json_NtlScalar( Json_Ntl_t * p, char * pToken )
+{
+    if ( p->nDepth == 1 )
+    {
+        if ( p->Section == JSON_KEY_NETLIST )
+            return Json_NtlStartKind( p, pToken );
+        if ( p->Section == JSON_KEY_NAME )
+        {
+            ABC_FREE( p->pName );
+            p->pName = Abc_UtilStrsav( pToken );
+        }
+        else if ( p->Section == JSON_KEY_OBJECTS || p->Section == JSON_KEY_REGS )
+        {
+            int * pValue = p->Section == JSON_KEY_OBJECTS ? &p->nObjsHint : &p->nRegs;
+            if ( !Json_NtlStrInt( pToken, pValue ) )
+                return 1;
+            if ( *pValue < 0 )
+            {
+                printf( "The number of %s (%d) is negative.\n", s_JsonKeys[p->Section], *pValue );
+                return 1;
+            }
+        }
+        else if ( p->Section == JSON_KEY_FUNC )
+            return Json_NtlStartMapped( p, pToken );
+        return 0;
+    }
+    if ( p->nDepth == 2 )
+    {
+        if ( p->Kind == JSON_NTL_GIA && p->Section == JSON_KEY_CINAMES )
+            Vec_PtrPush( p->vNamesIn, Abc_UtilStrsav(pToken) );
+        else if ( p->Kind == JSON_NTL_GIA && p->Section == JSON_KEY_CONAMES )
+            Vec_PtrPush( p->vNamesOut, Abc_UtilStrsav(pToken) );
+        else if ( p->Kind == JSON_NTL_ABC && p->Section == JSON_KEY_INPUTS )
+            Io_ReadCreatePi( p->pNtk, pToken );
+        else if ( p->Kind == JSON_NTL_ABC && p->Section == JSON_KEY_OUTPUTS )
+            return Json_NtlAddOutput( p, pToken, pToken );
+        return 0;
+    }
+    if ( p->nDepth == 3 && p->Section == JSON_KEY_NODES )
+    {
+        if ( p->NodeKey == JSON_KEY_NAME )
+            ABC_FREE( p->pNodeName ), p->pNodeName = Abc_UtilStrsav( pToken );
+        else if ( p->NodeKey == JSON_KEY_GATE )
+            ABC_FREE( p->pNodeGate ), p->pNodeGate = Abc_UtilStrsav( pToken );
+        else if ( p->NodeKey == JSON_KEY_OUT )
+            ABC_FREE( p->pNodeOut ), p->pNodeOut = Abc_UtilStrsav( pToken );
+        else if ( p->NodeKey == JSON_KEY_SOP )
+            ABC_FREE( p->pNodeSop ), p->pNodeSop = Abc_UtilStrsav( pToken );
+        return 0;
+    }
+    if ( p->nDepth == 3 || (p->nDepth == 4 && p->NodeKey == JSON_KEY_FANINS) )
+    {
+        Vec_IntPush( p->vRec, Vec_StrSize(p->vStr) );
+        Vec_StrPrintStr( p->vStr, pToken );
+        Vec_StrPush( p->vStr, '\0' );
+    }
+    return 0;
+}
+static int Json_NtlRecord( Json_Ntl_t * p )
+{
+    if ( p->Kind == JSON_NTL_GIA && p->Section == JSON_KEY_OBJS )
+        return Json_NtlAddGiaObj( p );
+    if ( p->Kind == JSON_NTL_GIA && p->Section == JSON_KEY_LUTS )
+        return Json_NtlAddMapping( p, p->vLuts );
+    if ( p->Kind == JSON_NTL_GIA && p->Section == JSON_KEY_CELLS )
+        return Json_NtlAddMapping( p, p->vCells );
+    if ( p->Kind == JSON_NTL_ABC && p->Section == JSON_KEY_OUTPUTS )
+    {
+        if ( Json_NtlRecNum(p) != 2 )
+        {
+            printf( "Output %d should have the name and the driver.\n", Abc_NtkPoNum(p->pNtk) );
+            return 1;
+        }
+        return Json_NtlAddOutput( p, Json_NtlRecStr(p, 0), Json_NtlRecStr(p, 1) );
+    }
+    if ( p->Kind == JSON_NTL_ABC && p->Section == JSON_KEY_LATCHES )
+        return Json_NtlAddLatch( p );
+    if ( p->Kind == JSON_NTL_ABC && p->Section == JSON_KEY_NODES )
+        return Json_NtlAddNode( p );
+    return 0;
+}
+int Json_NtlEvent( void * pUser, int Event, char * pToken )
+{
+    Json_Ntl_t * p = (Json_Ntl_t *)pUser;
+    if ( Event == JSON_EVENT_OBJ_BEG || Event == JSON_EVENT_ARR_BEG )
+    {
+        p->nDepth++;
+        if ( p->nDepth == 1 && Event != JSON_EVENT_OBJ_BEG )
+        {
+            printf( "The netlist should be a JSON object.\n" );
+            return 1;
+        }
+        if ( p->nDepth == 2 && p->Section >= JSON_KEY_OBJS && p->Section <= JSON_KEY_NODES && p->Kind == 0 )
+        {
+            printf( "The netlist kind should be given before the data.\n" );
+            return 1;
+        }
+        if ( p->nDepth == 3 )
+        {
+            Vec_IntClear( p->vRec );
+            Vec_StrClear( p->vStr );
+            p->NodeKey = JSON_KEY_UNKNOWN;
+        }
+        return 0;
+    }
+    if ( Event == JSON_EVENT_OBJ_END || Event == JSON_EVENT_ARR_END )
+    {
+        int RetValue = p->nDepth == 3 ? Json_NtlRecord( p ) : 0;
+        if ( p->nDepth == 3 )
+        {
+            ABC_FREE( p->pNodeName );
+            ABC_FREE( p->pNodeGate );
+            ABC_FREE( p->pNodeOut );
+            ABC_FREE( p->pNodeSop );
+        }
+        p->nDepth--;
+        return RetValue;
+    }
+    if ( Event == JSON_EVENT_KEY )
+    {
+        if ( p->nDepth == 1 )
+            p->Section = Json_NtlKeyFind( pToken );
+        else if ( p->nDepth == 3 )
+            p->NodeKey = Json_NtlKeyFind( pToken );
+        return 0;
+    }
+    return Json_NtlScalar( p, pToken );
+}
+static Gia_Man_t * Json_NtlDeriveGia( Json_Ntl_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    int i, k, nSize, * pRec;
+    p->pGia = NULL;
+    if ( p->nRegs > Gia_ManCiNum(pGia) || p->nRegs > Gia_ManCoNum(pGia) )
+    {
+        printf( "The number of registers (%d) exceeds the number of CIs or COs.\n", p->nRegs );
+        Gia_ManStop( pGia );
+        return NULL;
+    }
+    Gia_ManSetRegNum( pGia, p->nRegs );
+    pGia->pName = p->pName; p->pName = NULL;
+    if ( Vec_PtrSize(p->vNamesIn) == Gia_ManCiNum(pGia) )
+        pGia->vNamesIn = p->vNamesIn, p->vNamesIn = NULL;
+    else if ( Vec_PtrSize(p->vNamesIn) )
+        printf( "Ignoring %d CI names for %d CIs.\n", Vec_PtrSize(p->vNamesIn), Gia_ManCiNum(pGia) );
+    if ( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(pGia) )
+        pGia->vNamesOut = p->vNamesOut, p->vNamesOut = NULL;
+    else if ( Vec_PtrSize(p->vNamesOut) )
+        printf( "Ignoring %d CO names for %d COs.\n", Vec_PtrSize(p->vNamesOut), Gia_ManCoNum(pGia) );
+    // LUT mapping: [size, root, fanins]
+    if ( Vec_IntSize(p->vLuts) )
+    {
+        pGia->vMapping = Vec_IntStart( Gia_ManObjNum(pGia) );
+        for ( i = 0; i < Vec_IntSize(p->vLuts); i += nSize + 1 )
+        {
+            nSize = Vec_IntEntry( p->vLuts, i );
+            pRec  = Vec_IntEntryP( p->vLuts, i+1 );
+            for ( k = 0; k < nSize; k++ )
+                if ( pRec[k] <= 0 || pRec[k] >= Gia_ManObjNum(pGia) )
+                    break;
+            if ( k < nSize || !Gia_ObjIsAnd(Gia_ManObj(pGia, pRec[0])) )
+            {
+                printf( "LUT rooted in object %d is not valid.\n", pRec[0] );
+                Vec_IntFreeP( &pGia->vMapping );
+                break;
+            }
+            Vec_IntWriteEntry( pGia->vMapping, pRec[0], Vec_IntSize(pGia->vMapping) );
+            Vec_IntPush( pGia->vMapping, nSize - 1 );
+            for ( k = 1; k < nSize; k++ )
+                Vec_IntPush( pGia->vMapping, pRec[k] );
+            Vec_IntPush( pGia->vMapping, pRec[0] );
+        }
+    }
+    // cell mapping: [size, literal, cell, fanin literals]
+    if ( Vec_IntSize(p->vCells) )
+    {
+        pGia->vCellMapping = Vec_IntStart( 2*Gia_ManObjNum(pGia) );
+        for ( i = 0; i < Vec_IntSize(p->vCells); i += nSize + 1 )
+        {
+            nSize = Vec_IntEntry( p->vCells, i );
+            pRec  = Vec_IntEntryP( p->vCells, i+1 );
+            for ( k = 2; k < nSize; k++ )
+                if ( pRec[k] < 0 || pRec[k] >= 2*Gia_ManObjNum(pGia) )
+                    break;
+            // the cell is rooted in an AND node or a complemented CI (inverter only), which is mapped only once;
+            // the negative IDs stand for an inverter (-1) and a barrier buffer (-2)
+            if ( k < nSize || pRec[0] < 2 || pRec[0] >= 2*Gia_ManObjNum(pGia) ||
+                 !(Gia_ObjIsAnd(Gia_ManObj(pGia, Abc_Lit2Var(pRec[0]))) || (pRec[1] == -1 && Abc_LitIsCompl(pRec[0]) && Gia_ObjIsCi(Gia_ManObj(pGia, Abc_Lit2Var(pRec[0]))))) ||
+                 Vec_IntEntry(pGia->vCellMapping, pRec[0]) != 0 || pRec[1] < -2 || (pRec[1] < 0 && nSize > 2) ||
+                 (pRec[1] == -2 && (Abc_LitIsCompl(pRec[0]) || !Gia_ObjIsBuf(Gia_ManObj(pGia, Abc_Lit2Var(pRec[0]))))) )
+            {
+                printf( "Cell of literal %d is not valid.\n", pRec[0] );
+                Vec_IntFreeP( &pGia->vCellMapping );
+                break;
+            }
+            if ( pRec[1] < 0 )
+            {
+                Vec_IntWriteEntry( pGia->vCellMapping, pRec[0], pRec[1] );
+                continue;
+            }
+            Vec_IntWriteEntry( pGia->vCellMapping, pRec[0], Vec_IntSize(pGia->vCellMapping) );
+            Vec_IntPush( pGia->vCellMapping, nSize - 2 );
+            for ( k = 2; k < nSize; k++ )
+                Vec_IntPush( pGia->vCellMapping, pRec[k] );
+            Vec_IntPush( pGia->vCellMapping, pRec[1] );
+        }
+        // an inverter of an AND node is driven by the cell implementing the opposite literal
+        if ( pGia->vCellMapping )
+            for ( i = 2; i < 2*Gia_ManObjNum(pGia); i++ )
+                if ( Vec_IntEntry(pGia->vCellMapping, i) == -1 && Gia_ObjIsAnd(Gia_ManObj(pGia, Abc_Lit2Var(i))) && (Vec_IntEntry(pGia->vCellMapping, Abc_LitNot(i)) == 0 || Vec_IntEntry(pGia->vCellMapping, Abc_LitNot(i)) == -1) )
+                {
+                    printf( "Inverter of literal %d is not driven by a cell.\n", i );
+                    Vec_IntFreeP( &pGia->vCellMapping );
+                    break;
+                }
+    }
+    return pGia;
+}
+static Abc_Ntk_t * Json_NtlDeriveNtk( Json_Ntl_t * p, char * pFileName )
+{
+    Abc_Ntk_t * pNtk = p->pNtk, * pTemp;
+    p->pNtk = NULL;
+    pNtk->pName = Extra_UtilStrsav( p->pName && *p->pName ? p->pName : Extra_FileNameGeneric(pFileName) );
+    pNtk->pSpec = Extra_UtilStrsav( pFileName );
+    Abc_NtkFinalizeRead( pNtk );
+    if ( !Abc_NtkCheckRead( pNtk ) )
+    {
+        printf( "Json_ReadNetlist(): The network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    pNtk = Abc_NtkToLogic( pTemp = pNtk );
+    Abc_NtkDelete( pTemp );
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the JSON netlist written by Json_WriteGia() or Json_WriteNtk().]
+
+  Description [Depending on the netlist kind, returns the AIG in *ppGia
+  or the logic network in *ppNtk. Returns 0 if reading has failed.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Json_ReadNetlist( char * pFileName, Abc_Ntk_t ** ppNtk, Gia_Man_t ** ppGia )
+{
+    Json_Ntl_t Ntl, * p = &Ntl;
+    int RetValue;
+    *ppNtk = NULL;
+    *ppGia = NULL;
+    memset( p, 0, sizeof(Json_Ntl_t) );
+    p->vRec      = Vec_IntAlloc( 16 );
+    p->vStr      = Vec_StrAlloc( 100 );
+    p->vLuts     = Vec_IntAlloc( 0 );
+    p->vCells    = Vec_IntAlloc( 0 );
+    p->vNamesIn  = Vec_PtrAlloc( 0 );
+    p->vNamesOut = Vec_PtrAlloc( 0 );
+    RetValue = Json_SaxParse( pFileName, Json_NtlEvent, p );
+    if ( RetValue && p->Kind == 0 )
+    {
+        printf( "Json_ReadNetlist(): File \"%s\" does not contain a netlist.\n", pFileName );
+        RetValue = 0;
+    }
+    if ( RetValue && p->Kind == JSON_NTL_GIA )
+        RetValue = (*ppGia = Json_NtlDeriveGia( p )) != NULL;
+    if ( RetValue && p->Kind == JSON_NTL_ABC )
+        RetValue = (*ppNtk = Json_NtlDeriveNtk( p, pFileName )) != NULL;
+    if ( p->pGia )
+        Gia_ManStop( p->pGia );
+    if ( p->pNtk )
+        Abc_NtkDelete( p->pNtk );
+    ABC_FREE( p->pName );
+    ABC_FREE( p->pNodeName );
+    ABC_FREE( p->pNodeGate );
+    ABC_FREE( p->pNodeOut );
+    ABC_FREE( p->pNodeSop );
+    if ( p->vNamesIn )
+        Vec_PtrFreeFree( p->vNamesIn );
+    if ( p->vNamesOut )
+        Vec_PtrFreeFree( p->vNamesOut );
+    Vec_IntFree( p->vRec );
+    Vec_StrFree( p->vStr );
+    Vec_IntFree( p->vLuts );
+    Vec_IntFree( p->vCells );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,785 @@
+/**CFile****************************************************************
+
+  FileName    [ioReadBlifFast.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Fast reader for flat BLIF files.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: ioReadBlifFast.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "base/main/main.h"
+#include "map/mio/mio.h"
+#include "misc/util/utilNam.h"
+#include "misc/util/utilTruth.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Io_BlifFast_t_       Io_BlifFast_t;   // all reading info
+struct Io_BlifFast_t_
+{
+    // file contents
+    char *               pFileName;    // the name of the file
+    char *               pBuffer;      // the file contents
+    char *               pLimit;       // the end of the file contents
+    int                  nFileSize;    // the size of the file
+    int                  fMapped;      // the contents are memory-mapped
+    char *               pCur;         // the current reading position
+    int                  iLine;        // the current line number
+    int                  iLineStart;   // the first line of the current directive
+    int                  fPending;     // the tokens of the next line are ready
+    Vec_Ptr_t *          vTokens;      // the tokens of the current line
+    Vec_Ptr_t *          vCover;       // the tokens of the current cover
+    // parsed model
+    char *               pModel;       // the name of the model
+    Abc_Nam_t *          pNames;       // the signal names
+    Vec_Int_t *          vPis;         // the name IDs of the PIs
+    Vec_Int_t *          vPos;         // the name IDs of the POs
+    Vec_Int_t *          vLatches;     // the input, output and init value of each latch
+    Vec_Int_t *          vNodes;       // the start of each node in vFanins
+    Vec_Int_t *          vFanins;      // the fanin count, the fanin IDs and the output ID of each node
+    Vec_Int_t *          vSops;        // the start of the SOP of each node in vSopData
+    Vec_Str_t *          vSopData;     // the SOPs of the nodes
+    Vec_Ptr_t *          vGates;       // the gates of the nodes
+    Mio_Library_t *      pGenlib;      // the library used by the nodes
+    // reading status
+    int                  fUnsupp;      // the file needs the general reader
+    char                 sError[1000]; // the error string
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the file into memory.]
+
+  Description [Maps the file into memory if possible. Since the tokens are
+  zero-terminated in place, the mapping is private and the last character
+  of the file should be a new-line character. Otherwise, the file is read
+  into a buffer with one extra character.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastLoadFile( Io_BlifFast_t * p )
+{
+    FILE * pFile;
+    int RetValue;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( p->pFileName, O_RDONLY );
+    if ( fd >= 0 && fstat( fd, &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size > 0 && Stat.st_size < 0x7FFFFFFF )
+    {
+        p->pBuffer = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+        if ( p->pBuffer == (char *)MAP_FAILED )
+            p->pBuffer = NULL;
+        else if ( p->pBuffer[Stat.st_size-1] != '\n' )
+        {
+            munmap( p->pBuffer, (size_t)Stat.st_size );
+            p->pBuffer = NULL;
+        }
+        else
+        {
+            p->nFileSize = (int)Stat.st_size;
+            p->fMapped   = 1;
+        }
+    }
+    if ( fd >= 0 )
+        close( fd );
+#endif
+    if ( p->pBuffer == NULL )
+    {
+        pFile = fopen( p->pFileName, "rb" );
+        if ( pFile == NULL )
+        {
+            sprintf( p->sError, "Cannot open input file \"%s\".", p->pFileName );
+            return 0;
+        }
+        p->nFileSize = Extra_FileSize( p->pFileName );
+        p->pBuffer   = ABC_ALLOC( char, p->nFileSize + 1 );
+        RetValue     = fread( p->pBuffer, p->nFileSize, 1, pFile );
+        fclose( pFile );
+        if ( p->nFileSize > 0 && RetValue != 1 )
+        {
+            sprintf( p->sError, "Cannot read input file \"%s\".", p->pFileName );
+            return 0;
+        }
+        p->pBuffer[p->nFileSize] = 0;
+    }
+    p->pCur   = p->pBuffer;
+    p->pLimit = p->pBuffer + p->nFileSize;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates and deallocates the reader.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_BlifFast_t * Io_BlifFastAlloc( char * pFileName )
+{
+    Io_BlifFast_t * p;
+    p = ABC_CALLOC( Io_BlifFast_t, 1 );
+    p->pFileName = pFileName;
+    p->vTokens   = Vec_PtrAlloc( 100 );
+    p->vCover    = Vec_PtrAlloc( 100 );
+    p->vPis      = Vec_IntAlloc( 100 );
+    p->vPos      = Vec_IntAlloc( 100 );
+    p->vLatches  = Vec_IntAlloc( 100 );
+    p->vNodes    = Vec_IntAlloc( 1000 );
+    p->vFanins   = Vec_IntAlloc( 1000 );
+    p->vSops     = Vec_IntAlloc( 1000 );
+    p->vSopData  = Vec_StrAlloc( 1000 );
+    p->vGates    = Vec_PtrAlloc( 1000 );
+    return p;
+}
+static void Io_BlifFastFree( Io_BlifFast_t * p )
+{
+#ifndef _WIN32
+    if ( p->fMapped )
+        munmap( p->pBuffer, (size_t)p->nFileSize );
+    else
+#endif
+    ABC_FREE( p->pBuffer );
+    if ( p->pNames )
+        Abc_NamStop( p->pNames );
+    Vec_PtrFree( p->vTokens );
+    Vec_PtrFree( p->vCover );
+    Vec_IntFree( p->vPis );
+    Vec_IntFree( p->vPos );
+    Vec_IntFree( p->vLatches );
+    Vec_IntFree( p->vNodes );
+    Vec_IntFree( p->vFanins );
+    Vec_IntFree( p->vSops );
+    Vec_StrFree( p->vSopData );
+    Vec_PtrFree( p->vGates );
+    ABC_FREE( p->pModel );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Skips the characters of one token.]
+
+  Description [Returns the first character not greater than the space
+  (the space, the tab, the carriage return, or the zero terminator).
+  Checks eight characters at a time using the well-known bit trick,
+  which marks the bytes whose value is less than 0x21.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Io_BlifFastSkipToken( char * pCur, char * pEnd )
+{
+    word Word, Mask;
+    while ( pCur + 8 <= pEnd )
+    {
+        memcpy( &Word, pCur, 8 );
+        Mask = (Word - ABC_CONST(0x2121212121212121)) & ~Word & ABC_CONST(0x8080808080808080);
+        if ( Mask )
+            return pCur + (Abc_Tt6FirstBit(Mask) >> 3);
+        pCur += 8;
+    }
+    while ( pCur < pEnd && (unsigned char)*pCur > ' ' )
+        pCur++;
+    return pCur;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the tokens of the next line.]
+
+  Description [Skips empty lines and comments, joins the lines continued
+  with the backslash, and splits the line into zero-terminated tokens,
+  which are stored in p->vTokens. Returns the number of tokens or 0 when
+  the end of file is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastReadLine( Io_BlifFast_t * p )
+{
+    char * pBeg, * pEnd, * pTemp;
+    if ( p->fPending )
+    {
+        p->fPending = 0;
+        return Vec_PtrSize(p->vTokens);
+    }
+    Vec_PtrClear( p->vTokens );
+    while ( p->pCur < p->pLimit )
+    {
+        // find the line
+        pBeg = p->pCur;
+        p->iLineStart = ++p->iLine;
+        while ( 1 )
+        {
+            pEnd = (char *)memchr( p->pCur, '\n', p->pLimit - p->pCur );
+            if ( pEnd == NULL )
+                pEnd = p->pLimit;
+            p->pCur = pEnd + (pEnd < p->pLimit);
+            // remove the comment
+            pTemp = (char *)memchr( pBeg, '#', pEnd - pBeg );
+            if ( pTemp != NULL )
+                memset( pTemp, ' ', pEnd - pTemp );
+            // check if the line is continued
+            for ( pTemp = pEnd - 1; pTemp >= pBeg && (unsigned char)*pTemp <= ' '; pTemp-- );
+            if ( pTemp < pBeg || *pTemp != '\\' || p->pCur == p->pLimit )
+                break;
+            *pTemp = ' ';
+            *pEnd  = ' ';
+            p->iLine++;
+        }
+        // split the line into tokens
+        *pEnd = 0;
+        for ( pTemp = pBeg; pTemp < pEnd; )
+        {
+            while ( pTemp < pEnd && (unsigned char)*pTemp <= ' ' )
+                pTemp++;
+            if ( pTemp == pEnd )
+                break;
+            Vec_PtrPush( p->vTokens, pTemp );
+            pTemp = Io_BlifFastSkipToken( pTemp, pEnd );
+            *pTemp++ = 0;
+        }
+        if ( Vec_PtrSize(p->vTokens) > 0 )
+            return Vec_PtrSize(p->vTokens);
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the cover of the node.]
+
+  Description [Reads the lines following the .names line and appends the
+  SOP to p->vSopData. The checks are the same as in the general reader.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastParseCover( Io_BlifFast_t * p, int nFanins )
+{
+    char * pProduct, * pOutput, * pToken, c;
+    int i, Polarity = -1;
+    // collect the tokens of the cover
+    Vec_PtrClear( p->vCover );
+    while ( Io_BlifFastReadLine(p) )
+    {
+        if ( *(char *)Vec_PtrEntry(p->vTokens, 0) == '.' )
+        {
+            p->fPending = 1;
+            break;
+        }
+        Vec_PtrForEachEntry( char *, p->vTokens, pToken, i )
+            Vec_PtrPush( p->vCover, pToken );
+    }
+    Vec_IntPush( p->vSops, Vec_StrSize(p->vSopData) );
+    if ( Vec_PtrSize(p->vCover) == 0 )
+    {
+        Vec_StrPrintStr( p->vSopData, " 0\n" );
+        Vec_StrPush( p->vSopData, '\0' );
+        return 1;
+    }
+    if ( Vec_PtrSize(p->vCover) == 1 )
+    {
+        pOutput = (char *)Vec_PtrEntry( p->vCover, 0 );
+        c = pOutput[0];
+        if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
+        {
+            sprintf( p->sError, "Line %d: Constant table has wrong output value \"%s\".", p->iLine, pOutput );
+            return 0;
+        }
+        Vec_StrPrintStr( p->vSopData, pOutput[0] == '0' ? " 0\n" : " 1\n" );
+        Vec_StrPush( p->vSopData, '\0' );
+        return 1;
+    }
+    if ( Vec_PtrSize(p->vCover) % 2 == 1 )
+    {
+        sprintf( p->sError, "Line %d: Table has odd number of tokens (%d).", p->iLine, Vec_PtrSize(p->vCover) );
+        return 0;
+    }
+    for ( i = 0; i < Vec_PtrSize(p->vCover)/2; i++ )
+    {
+        pProduct = (char *)Vec_PtrEntry( p->vCover, 2*i + 0 );
+        pOutput  = (char *)Vec_PtrEntry( p->vCover, 2*i + 1 );
+        if ( strlen(pProduct) != (unsigned)nFanins )
+        {
+            sprintf( p->sError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", p->iLine, pProduct, nFanins );
+            return 0;
+        }
+        c = pOutput[0];
+        if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
+        {
+            sprintf( p->sError, "Line %d: Output value \"%s\" is incorrect.", p->iLine, pOutput );
+            return 0;
+        }
+        if ( Polarity == -1 )
+            Polarity = (c=='1' || c=='x');
+        else if ( Polarity != (c=='1' || c=='x') )
+        {
+            sprintf( p->sError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", p->iLine, pOutput, Polarity );
+            return 0;
+        }
+        Vec_StrPrintStr( p->vSopData, pProduct );
+        Vec_StrPush( p->vSopData, ' ' );
+        Vec_StrPush( p->vSopData, pOutput[0] );
+        Vec_StrPush( p->vSopData, '\n' );
+    }
+    Vec_StrPush( p->vSopData, '\0' );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the .names line.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastParseNames( Io_BlifFast_t * p )
+{
+    int i, nTokens = Vec_PtrSize(p->vTokens);
+    if ( p->pGenlib )
+    {
+        sprintf( p->sError, "Line %d: The .names line is used in the mapped network.", p->iLineStart );
+        return 0;
+    }
+    if ( nTokens < 2 )
+    {
+        sprintf( p->sError, "Line %d: The .names line has no output.", p->iLineStart );
+        return 0;
+    }
+    Vec_IntPush( p->vNodes, Vec_IntSize(p->vFanins) );
+    Vec_IntPush( p->vFanins, nTokens - 2 );
+    for ( i = 1; i < nTokens; i++ )
+        Vec_IntPush( p->vFanins, Abc_NamStrFindOrAdd(p->pNames, (char *)Vec_PtrEntry(p->vTokens, i), NULL) );
+    return Io_BlifFastParseCover( p, nTokens - 2 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the .gate line.]
+
+  Description [The formal inputs are reordered to be in the same order
+  as the pins of the gate. The gates with twin outputs are not supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastParseGate( Io_BlifFast_t * p )
+{
+    extern int Io_ReadBlifReorderFormalNames( Vec_Ptr_t * vTokens, Mio_Gate_t * pGate, Mio_Gate_t * pTwin );
+    Mio_Library_t * pGenlib;
+    Mio_Gate_t * pGate;
+    char * pName;
+    int i;
+    if ( Vec_IntSize(p->vNodes) > 0 && p->pGenlib == NULL )
+    {
+        sprintf( p->sError, "Line %d: The .gate line is used in the network with .names lines.", p->iLineStart );
+        return 0;
+    }
+    pGenlib = (Mio_Library_t *)Abc_FrameReadLibGen();
+    if ( pGenlib == NULL )
+    {
+        sprintf( p->sError, "Line %d: The current library is not available.", p->iLineStart );
+        return 0;
+    }
+    if ( Vec_PtrSize(p->vTokens) < 2 )
+    {
+        sprintf( p->sError, "Line %d: The .gate line has less than two tokens.", p->iLineStart );
+        return 0;
+    }
+    pGate = Mio_LibraryReadGateByName( pGenlib, (char *)Vec_PtrEntry(p->vTokens, 1), NULL );
+    if ( pGate == NULL )
+    {
+        sprintf( p->sError, "Line %d: Cannot find gate \"%s\" in the library.", p->iLineStart, (char *)Vec_PtrEntry(p->vTokens, 1) );
+        return 0;
+    }
+    if ( Mio_GateReadTwin(pGate) != NULL )
+    {
+        p->fUnsupp = 1;
+        return 0;
+    }
+    p->pGenlib = pGenlib;
+    if ( !Io_ReadBlifReorderFormalNames( p->vTokens, pGate, NULL ) )
+    {
+        sprintf( p->sError, "Line %d: Mismatch in the fanins of gate \"%s\".", p->iLineStart, (char *)Vec_PtrEntry(p->vTokens, 1) );
+        return 0;
+    }
+    Vec_IntPush( p->vNodes, Vec_IntSize(p->vFanins) );
+    Vec_IntPush( p->vFanins, Vec_PtrSize(p->vTokens) - 3 );
+    Vec_PtrForEachEntryStart( char *, p->vTokens, pName, i, 2 )
+    {
+        while ( *pName && *pName != '=' )
+            pName++;
+        if ( *pName++ == 0 )
+        {
+            sprintf( p->sError, "Line %d: Invalid gate input assignment.", p->iLineStart );
+            return 0;
+        }
+        Vec_IntPush( p->vFanins, Abc_NamStrFindOrAdd(p->pNames, pName, NULL) );
+    }
+    Vec_PtrPush( p->vGates, pGate );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the .latch line.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastParseLatch( Io_BlifFast_t * p )
+{
+    int Init, nTokens = Vec_PtrSize(p->vTokens);
+    if ( nTokens < 3 )
+    {
+        sprintf( p->sError, "Line %d: Latch does not have input name and output name.", p->iLineStart );
+        return 0;
+    }
+    if ( nTokens > 6 )
+        printf( "Warning: Line %d has .latch directive with unrecognized entries (the total of %d entries).\n", p->iLineStart, nTokens );
+    Init = nTokens > 3 ? atoi( (char *)Vec_PtrEntryLast(p->vTokens) ) : 2;
+    if ( Init < 0 || Init > 3 )
+    {
+        sprintf( p->sError, "Line %d: Initial state of the latch is incorrect \"%s\".", p->iLineStart, (char *)Vec_PtrEntry(p->vTokens, 3) );
+        return 0;
+    }
+    Vec_IntPush( p->vLatches, Abc_NamStrFindOrAdd(p->pNames, (char *)Vec_PtrEntry(p->vTokens, 1), NULL) );
+    Vec_IntPush( p->vLatches, Abc_NamStrFindOrAdd(p->pNames, (char *)Vec_PtrEntry(p->vTokens, 2), NULL) );
+    Vec_IntPush( p->vLatches, Init );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the file.]
+
+  Description [Returns 0 if there is a syntax error or if the file uses
+  the features that are only supported by the general reader (hierarchy,
+  timing information, EXDC, etc). In the latter case, p->fUnsupp is set.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastParse( Io_BlifFast_t * p )
+{
+    char * pDir;
+    int i, nModels = 0, fEnd = 0;
+    p->pNames = Abc_NamStart( p->nFileSize / 64 + 1000, 12 );
+    while ( Io_BlifFastReadLine(p) )
+    {
+        pDir = (char *)Vec_PtrEntry( p->vTokens, 0 );
+        if ( pDir[0] != '.' )
+        {
+            sprintf( p->sError, "Line %d: Unexpected token \"%s\".", p->iLineStart, pDir );
+            return 0;
+        }
+        pDir++;
+        if ( fEnd && strcmp(pDir, "model") )
+        {
+            p->fUnsupp = 1;
+            return 0;
+        }
+        if ( !strcmp(pDir, "names") )
+        {
+            if ( !Io_BlifFastParseNames(p) )
+                return 0;
+        }
+        else if ( !strcmp(pDir, "gate") )
+        {
+            if ( !Io_BlifFastParseGate(p) )
+                return 0;
+        }
+        else if ( !strcmp(pDir, "inputs") )
+        {
+            for ( i = 1; i < Vec_PtrSize(p->vTokens); i++ )
+                Vec_IntPush( p->vPis, Abc_NamStrFindOrAdd(p->pNames, (char *)Vec_PtrEntry(p->vTokens, i), NULL) );
+        }
+        else if ( !strcmp(pDir, "outputs") )
+        {
+            for ( i = 1; i < Vec_PtrSize(p->vTokens); i++ )
+                Vec_IntPush( p->vPos, Abc_NamStrFindOrAdd(p->pNames, (char *)Vec_PtrEntry(p->vTokens, i), NULL) );
+        }
+        else if ( !strcmp(pDir, "latch") )
+        {
+            if ( !Io_BlifFastParseLatch(p) )
+                return 0;
+        }
+        else if ( !strcmp(pDir, "model") )
+        {
+            if ( nModels++ > 0 )
+            {
+                p->fUnsupp = 1;
+                return 0;
+            }
+            if ( Vec_PtrSize(p->vTokens) > 1 )
+                p->pModel = Extra_UtilStrsav( (char *)Vec_PtrEntry(p->vTokens, 1) );
+        }
+        else if ( !strcmp(pDir, "end") )
+            fEnd = 1;
+        else
+        {
+            p->fUnsupp = 1;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the logic network.]
+
+  Description [Creates the objects in the same order as the general
+  reader followed by the conversion of the netlist into the logic network:
+  PIs, POs, latches, and the nodes in the order of the file. The nodes are
+  connected after all of them are created. The non-driven signals are
+  driven by constant 0 nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Io_BlifFastDerive( Io_BlifFast_t * p )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj, * pTerm;
+    Vec_Ptr_t * vDrivers;
+    Vec_Int_t * vUndriven;
+    int * pFanins;
+    int i, k, Id, Entry, iFirst;
+    pNtk = Abc_NtkAlloc( ABC_NTK_LOGIC, p->pGenlib ? ABC_FUNC_MAP : ABC_FUNC_SOP, 1 );
+    pNtk->pName = p->pModel ? Extra_UtilStrsav(p->pModel) : Extra_FileNameGeneric(p->pFileName);
+    pNtk->pSpec = Extra_UtilStrsav( p->pFileName );
+    Nm_ManFree( pNtk->pManName );
+    pNtk->pManName = Nm_ManCreate( Abc_NamObjNumMax(p->pNames) + Vec_IntSize(p->vPos) + 3 * Vec_IntSize(p->vLatches) );
+    vDrivers = Vec_PtrStart( Abc_NamObjNumMax(p->pNames) );
+    // create the terminals
+    Vec_IntForEachEntry( p->vPis, Id, i )
+    {
+        if ( Vec_PtrEntry(vDrivers, Id) != NULL )
+        {
+            sprintf( p->sError, "Primary input \"%s\" is listed more than once.", Abc_NamStr(p->pNames, Id) );
+            goto finish;
+        }
+        pObj = Abc_NtkCreatePi( pNtk );
+        Abc_ObjAssignName( pObj, Abc_NamStr(p->pNames, Id), NULL );
+        Vec_PtrWriteEntry( vDrivers, Id, pObj );
+    }
+    Vec_IntForEachEntry( p->vPos, Id, i )
+        Abc_ObjAssignName( Abc_NtkCreatePo(pNtk), Abc_NamStr(p->pNames, Id), NULL );
+    Vec_IntForEachEntryTriple( p->vLatches, Entry, Id, k, i )
+    {
+        if ( Vec_PtrEntry(vDrivers, Id) != NULL )
+        {
+            sprintf( p->sError, "Signal \"%s\" is defined more than once.", Abc_NamStr(p->pNames, Id) );
+            goto finish;
+        }
+        pObj  = Abc_NtkCreateLatch( pNtk );
+        pTerm = Abc_NtkCreateBi( pNtk );
+        Abc_ObjAddFanin( pObj, pTerm );
+        Abc_ObjAssignName( pTerm, Abc_ObjName(pTerm), NULL );
+        pTerm = Abc_NtkCreateBo( pNtk );
+        Abc_ObjAddFanin( pTerm, pObj );
+        Abc_ObjAssignName( pTerm, Abc_NamStr(p->pNames, Id), NULL );
+        Abc_ObjAssignName( pObj, Abc_NamStr(p->pNames, Id), "L" );
+        if ( k == 0 )
+            Abc_LatchSetInit0( pObj );
+        else if ( k == 1 )
+            Abc_LatchSetInit1( pObj );
+        else
+            Abc_LatchSetInitDc( pObj );
+        Vec_PtrWriteEntry( vDrivers, Id, pTerm );
+    }
+    // create the nodes
+    iFirst = Abc_NtkObjNumMax( pNtk );
+    Vec_IntForEachEntry( p->vNodes, Entry, i )
+    {
+        pFanins = Vec_IntEntryP( p->vFanins, Entry );
+        Id = pFanins[pFanins[0] + 1];
+        if ( Vec_PtrEntry(vDrivers, Id) != NULL )
+        {
+            sprintf( p->sError, "Signal \"%s\" is defined more than once.", Abc_NamStr(p->pNames, Id) );
+            goto finish;
+        }
+        pObj = Abc_NtkCreateNode( pNtk );
+        Abc_ObjAssignName( pObj, Abc_NamStr(p->pNames, Id), NULL );
+        if ( p->pGenlib )
+            pObj->pData = Vec_PtrEntry( p->vGates, i );
+        else
+            pObj->pData = Abc_SopRegister( (Mem_Flex_t *)pNtk->pManFunc, Vec_StrEntryP(p->vSopData, Vec_IntEntry(p->vSops, i)) );
+        Vec_PtrWriteEntry( vDrivers, Id, pObj );
+    }
+    // drive the remaining signals by constants
+    vUndriven = Vec_IntAlloc( 100 );
+    Vec_IntForEachEntry( p->vNodes, Entry, i )
+    {
+        pFanins = Vec_IntEntryP( p->vFanins, Entry );
+        for ( k = 1; k <= pFanins[0]; k++ )
+            if ( Vec_PtrEntry(vDrivers, pFanins[k]) == NULL )
+                Vec_PtrWriteEntry( vDrivers, pFanins[k], (void *)1 ), Vec_IntPush( vUndriven, pFanins[k] );
+    }
+    Vec_IntForEachEntry( p->vPos, Id, i )
+        if ( Vec_PtrEntry(vDrivers, Id) == NULL )
+            Vec_PtrWriteEntry( vDrivers, Id, (void *)1 ), Vec_IntPush( vUndriven, Id );
+    Vec_IntForEachEntryTriple( p->vLatches, Id, Entry, k, i )
+        if ( Vec_PtrEntry(vDrivers, Id) == NULL )
+            Vec_PtrWriteEntry( vDrivers, Id, (void *)1 ), Vec_IntPush( vUndriven, Id );
+    Vec_IntForEachEntry( vUndriven, Id, i )
+    {
+        pObj = strcmp(Abc_NamStr(p->pNames, Id), "1\'b1") ? Abc_NtkCreateNodeConst0(pNtk) : Abc_NtkCreateNodeConst1(pNtk);
+        Abc_ObjAssignName( pObj, Abc_NamStr(p->pNames, Id), NULL );
+        Vec_PtrWriteEntry( vDrivers, Id, pObj );
+    }
+    if ( Vec_IntSize(vUndriven) > 0 )
+    {
+        printf( "Warning: Constant-0 drivers added to %d non-driven nets in network \"%s\":\n", Vec_IntSize(vUndriven), pNtk->pName );
+        Vec_IntForEachEntry( vUndriven, Id, i )
+        {
+            printf( "%s%s", (i? ", ": ""), Abc_NamStr(p->pNames, Id) );
+            if ( i == 3 )
+            {
+                if ( Vec_IntSize(vUndriven) > 3 )
+                    printf( " ..." );
+                break;
+            }
+        }
+        printf( "\n" );
+    }
+    Vec_IntFree( vUndriven );
+    // connect the objects
+    Vec_IntForEachEntry( p->vNodes, Entry, i )
+    {
+        pFanins = Vec_IntEntryP( p->vFanins, Entry );
+        pObj = Abc_NtkObj( pNtk, iFirst + i );
+        for ( k = 1; k <= pFanins[0]; k++ )
+            Abc_ObjAddFanin( pObj, (Abc_Obj_t *)Vec_PtrEntry(vDrivers, pFanins[k]) );
+    }
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Abc_ObjAddFanin( pObj, (Abc_Obj_t *)Vec_PtrEntry(vDrivers, Vec_IntEntry(p->vPos, i)) );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+        Abc_ObjAddFanin( Abc_ObjFanin0(pObj), (Abc_Obj_t *)Vec_PtrEntry(vDrivers, Vec_IntEntry(p->vLatches, 3*i)) );
+    Vec_PtrFree( vDrivers );
+    Abc_NtkLogicMakeSimpleCos( pNtk, 0 );
+    return pNtk;
+finish:
+    Vec_PtrFree( vDrivers );
+    Abc_NtkDelete( pNtk );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the flat BLIF file.]
+
+  Description [This reader is meant for large flat netlists, such as the
+  mapped netlists produced by the physical design tools. The file is
+  mapped into memory and split into tokens in place. The signal names
+  are hashed in one string store instead of creating a net object for
+  each of them. The logic network is derived directly, without creating
+  the netlist first. If the file uses the features not supported here
+  (hierarchy, timing information, EXDC, etc), the general reader is used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadBlifFast( char * pFileName, int fCheck, int fVerbose )
+{
+    Io_BlifFast_t * p;
+    Abc_Ntk_t * pNtk = NULL;
+    abctime clk = Abc_Clock();
+    double nMBytes;
+    p = Io_BlifFastAlloc( pFileName );
+    if ( Io_BlifFastLoadFile(p) && Io_BlifFastParse(p) )
+        pNtk = Io_BlifFastDerive( p );
+    nMBytes = 1.0 * p->nFileSize / (1 << 20);
+    if ( p->fUnsupp )
+    {
+        Io_BlifFastFree( p );
+        if ( fVerbose )
+            printf( "The file \"%s\" is read using the general BLIF reader.\n", pFileName );
+        return Io_Read( pFileName, IO_FILE_BLIF, fCheck, 0 );
+    }
+    if ( p->sError[0] )
+        fprintf( stdout, "%s\n", p->sError );
+    Io_BlifFastFree( p );
+    if ( pNtk == NULL )
+        return NULL;
+    if ( fCheck && !Abc_NtkCheckRead( pNtk ) )
+    {
+        printf( "Io_ReadBlifFast: The network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    if ( fVerbose )
+    {
+        double Time = 1.0 * (Abc_Clock() - clk) / CLOCKS_PER_SEC;
+        printf( "Read %.2f MB in %.2f sec (%.2f MB/s).  ", nMBytes, Time, Time > 0 ? nMBytes / Time : 0.0 );
+        printf( "Pi = %d. Po = %d. Lat = %d. Node = %d.\n", Abc_NtkPiNum(pNtk), Abc_NtkPoNum(pNtk), Abc_NtkLatchNum(pNtk), Abc_NtkNodeNum(pNtk) );
+    }
+    return pNtk;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,689 @@
+/**CFile****************************************************************
+
+  FileName    [ioState.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Saving and restoring the state of the ABC frame.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: ioState.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "base/main/mainInt.h"
+#include "map/mio/mio.h"
+#include "map/scl/sclLib.h"
+#include "aig/gia/gia.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IO_STATE_MAGIC    "ABC frame state"   // 15 characters and the terminator
+#define IO_STATE_VERSION  1
+
+// the header of the snapshot file
+typedef struct Io_StateHead_t_ Io_StateHead_t;
+struct Io_StateHead_t_
+{
+    char          Magic[16];        // the magic string
+    int           Version;          // the format version
+    int           nSections;        // the number of sections
+};
+
+// the header of one section (the contents are padded to 8 bytes)
+typedef struct Io_StateSect_t_ Io_StateSect_t;
+struct Io_StateSect_t_
+{
+    char          Tag[8];           // the section name
+    word          nBytes;           // the size of the contents
+};
+
+extern void       Abc_SclLoad( SC_Lib * pLib, SC_Lib ** ppScl );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the integer stored in place.]
+
+  Description [Returns 0 if the encoding runs past the end of the string
+  or does not fit into an integer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Io_StateGetI( Vec_Str_t * vIn, int * pPos, int * pValue )
+{
+    unsigned char ch;
+    unsigned Val = 0;
+    int i;
+    for ( i = 0; i < 5 && *pPos < Vec_StrSize(vIn); i++ )
+    {
+        ch = (unsigned char)Vec_StrEntry( vIn, (*pPos)++ );
+        Val |= (unsigned)(ch & 0x7f) << (7 * i);
+        if ( ch & 0x80 )
+            continue;
+        if ( (int)Val < 0 )
+            return 0;
+        *pValue = (int)Val;
+        return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the string stored in place.]
+
+  Description [Returns NULL if the string is not terminated before the
+  end of the data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Io_StateGetS( Vec_Str_t * vIn, int * pPos )
+{
+    char * pStr, * pEnd;
+    if ( *pPos >= Vec_StrSize(vIn) )
+        return NULL;
+    pStr = Vec_StrEntryP( vIn, *pPos );
+    pEnd = (char *)memchr( pStr, 0, (size_t)(Vec_StrSize(vIn) - *pPos) );
+    if ( pEnd == NULL )
+        return NULL;
+    *pPos += (int)(pEnd - pStr) + 1;
+    return pStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the fanin has the type expected by the object.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Io_StateFaninIsValid( int Type, Abc_Obj_t * pFanin )
+{
+    pFanin = Abc_ObjRegular( pFanin );
+    if ( Type == ABC_OBJ_LATCH )
+        return Abc_ObjIsBi(pFanin);
+    if ( Type == ABC_OBJ_BO )
+        return Abc_ObjIsLatch(pFanin);
+    return !Abc_ObjIsCo(pFanin) && !Abc_ObjIsLatch(pFanin);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the genlib library into the string.]
+
+  Description [The library is printed into a temporary file, which is
+  then read back, because the genlib writer only supports files.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Io_StateWriteGenlib( Mio_Library_t * pLib )
+{
+    Vec_Str_t * vOut;
+    FILE * pFile = tmpfile();
+    int nBytes;
+    if ( pFile == NULL )
+        return NULL;
+    Mio_WriteLibrary( pFile, pLib, 0, 0, 0 );
+    nBytes = (int)ftell( pFile );
+    rewind( pFile );
+    vOut = Vec_StrStart( nBytes + 1 );
+    if ( (int)fread( Vec_StrArray(vOut), 1, nBytes, pFile ) != nBytes )
+        Vec_StrFreeP( &vOut );
+    fclose( pFile );
+    return vOut;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the logic network into the string.]
+
+  Description [Supports the logic networks with SOPs or gates and the
+  structurally hashed AIGs. The objects other than nodes are written
+  first, in the order of their IDs, followed by the nodes. In the AIG,
+  the nodes are written in the topological order, so that they can be
+  hashed again when the network is restored. For each object, records
+  its type, its fanins, its name and its function (or the latch init
+  value). Finally, records the order of the terminals and the boxes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Io_StateWriteNtk( Abc_Ntk_t * pNtk )
+{
+    Vec_Str_t * vOut;
+    Vec_Ptr_t * vObjs, * vTerms[5];
+    Vec_Int_t * vMap;
+    Abc_Obj_t * pObj, * pFanin;
+    Mio_Gate_t * pGate;
+    char * pName;
+    int i, k, t;
+    assert( Abc_NtkIsStrash(pNtk) || Abc_NtkIsSopLogic(pNtk) || Abc_NtkIsMappedLogic(pNtk) );
+    // collect the objects in the order of writing
+    vObjs = Vec_PtrAlloc( Abc_NtkObjNum(pNtk) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( !Abc_ObjIsNode(pObj) )
+            Vec_PtrPush( vObjs, pObj );
+    if ( Abc_NtkIsStrash(pNtk) )
+    {
+        Vec_Ptr_t * vNodes = Abc_AigDfs( pNtk, 1, 0 );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+            Vec_PtrPush( vObjs, pObj );
+        Vec_PtrFree( vNodes );
+    }
+    else
+    {
+        Abc_NtkForEachNode( pNtk, pObj, i )
+            Vec_PtrPush( vObjs, pObj );
+    }
+    vMap = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+        Vec_IntWriteEntry( vMap, Abc_ObjId(pObj), i );
+    // write the network
+    vOut = Vec_StrAlloc( 16 * Abc_NtkObjNum(pNtk) + 1000 );
+    Vec_StrPutI( vOut, pNtk->ntkType );
+    Vec_StrPutI( vOut, pNtk->ntkFunc );
+    Vec_StrPutS( vOut, pNtk->pName ? pNtk->pName : (char *)"" );
+    Vec_StrPutS( vOut, pNtk->pSpec ? pNtk->pSpec : (char *)"" );
+    Vec_StrPutI( vOut, Vec_PtrSize(vObjs) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+    {
+        Vec_StrPutI( vOut, pObj->Type );
+        Vec_StrPutI( vOut, Abc_ObjFaninNum(pObj) );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Vec_StrPutI( vOut, Abc_Var2Lit(Vec_IntEntry(vMap, Abc_ObjId(pFanin)), Abc_NtkIsStrash(pNtk) && Abc_ObjFaninC(pObj, k)) );
+        pName = Nm_ManFindNameById( pNtk->pManName, Abc_ObjId(pObj) );
+        Vec_StrPutS( vOut, pName ? pName : (char *)"" );
+        if ( Abc_ObjIsLatch(pObj) )
+            Vec_StrPutI( vOut, Abc_LatchInit(pObj) );
+        else if ( Abc_ObjIsNode(pObj) && Abc_NtkIsSopLogic(pNtk) )
+            Vec_StrPutS( vOut, (char *)pObj->pData );
+        else if ( Abc_ObjIsNode(pObj) && Abc_NtkIsMappedLogic(pNtk) )
+        {
+            pGate = (Mio_Gate_t *)pObj->pData;
+            Vec_StrPutS( vOut, pGate ? Mio_GateReadName(pGate) : (char *)"" );
+            Vec_StrPutS( vOut, pGate ? Mio_GateReadOutName(pGate) : (char *)"" );
+        }
+    }
+    // write the order of the terminals and the boxes
+    vTerms[0] = pNtk->vPis;
+    vTerms[1] = pNtk->vPos;
+    vTerms[2] = pNtk->vCis;
+    vTerms[3] = pNtk->vCos;
+    vTerms[4] = pNtk->vBoxes;
+    for ( t = 0; t < 5; t++ )
+    {
+        Vec_StrPutI( vOut, Vec_PtrSize(vTerms[t]) );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vTerms[t], pObj, i )
+            Vec_StrPutI( vOut, Vec_IntEntry(vMap, Abc_ObjId(pObj)) );
+    }
+    Vec_IntFree( vMap );
+    Vec_PtrFree( vObjs );
+    return vOut;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the logic network from the string.]
+
+  Description [Returns NULL if the network cannot be restored, for
+  example, when its gates are not found in the current library. Since
+  the snapshot may come from anywhere, every number read is checked
+  against the size of the data and the number of objects before use.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_StateReadNtk( Vec_Str_t * vIn )
+{
+    Abc_Ntk_t * pNtk = NULL;
+    Abc_Obj_t * pObj, * pFanin0, * pFanin1;
+    Vec_Ptr_t * vObjs = NULL, * vTerms[5];
+    Vec_Int_t * vFanins = NULL, * vStarts = NULL, * vMarks = NULL;
+    Mio_Library_t * pLib;
+    char * pName, * pOutName, * pError = NULL;
+    int i, k, t, nObjs, nFanins, nTerms, Type, Lit, Init, fStrash, ntkType, ntkFunc, Pos = 0;
+    if ( !Io_StateGetI(vIn, &Pos, &ntkType) || !Io_StateGetI(vIn, &Pos, &ntkFunc) )
+    {
+        printf( "Io_StateReadNtk(): The network data is truncated.\n" );
+        return NULL;
+    }
+    fStrash = (ntkType == ABC_NTK_STRASH);
+    if ( !(fStrash && ntkFunc == ABC_FUNC_AIG) && !(ntkType == ABC_NTK_LOGIC && (ntkFunc == ABC_FUNC_SOP || ntkFunc == ABC_FUNC_MAP)) )
+    {
+        printf( "Io_StateReadNtk(): The network type (%d) or function type (%d) is not supported.\n", ntkType, ntkFunc );
+        return NULL;
+    }
+    pLib = (Mio_Library_t *)Abc_FrameReadLibGen();
+    if ( ntkFunc == ABC_FUNC_MAP && pLib == NULL )
+    {
+        printf( "Io_StateReadNtk(): The genlib library is not available.\n" );
+        return NULL;
+    }
+    pNtk = Abc_NtkAlloc( (Abc_NtkType_t)ntkType, (Abc_NtkFunc_t)ntkFunc, 1 );
+    if ( (pName = Io_StateGetS( vIn, &Pos )) == NULL )
+        { pError = "The network name is truncated."; goto finish; }
+    pNtk->pName = *pName ? Extra_UtilStrsav( pName ) : NULL;
+    if ( (pName = Io_StateGetS( vIn, &Pos )) == NULL )
+        { pError = "The network spec is truncated."; goto finish; }
+    pNtk->pSpec = *pName ? Extra_UtilStrsav( pName ) : NULL;
+    // create the objects and the AIG nodes (each object takes at least three bytes)
+    if ( !Io_StateGetI( vIn, &Pos, &nObjs ) || nObjs > (Vec_StrSize(vIn) - Pos) / 3 )
+        { pError = "The number of objects is invalid."; goto finish; }
+    vObjs   = Vec_PtrAlloc( nObjs );
+    vFanins = Vec_IntAlloc( 2 * nObjs );
+    vStarts = Vec_IntAlloc( nObjs + 1 );
+    vMarks  = Vec_IntAlloc( nObjs );
+    for ( i = 0; i < nObjs; i++ )
+    {
+        if ( !Io_StateGetI( vIn, &Pos, &Type ) || !Io_StateGetI( vIn, &Pos, &nFanins ) || nFanins > Vec_StrSize(vIn) - Pos )
+            { pError = "The object data is truncated."; goto finish; }
+        if ( Type != ABC_OBJ_PI && Type != ABC_OBJ_PO && Type != ABC_OBJ_BI && Type != ABC_OBJ_BO && 
+             Type != ABC_OBJ_NODE && Type != ABC_OBJ_LATCH && !(fStrash && Type == ABC_OBJ_CONST1) )
+            { pError = "The object type is invalid."; goto finish; }
+        if ( Type == ABC_OBJ_PI || Type == ABC_OBJ_CONST1 ? nFanins != 0 : Type != ABC_OBJ_NODE ? nFanins != 1 : fStrash && nFanins != 2 )
+            { pError = "The number of fanins does not match the object type."; goto finish; }
+        Vec_IntPush( vStarts, Vec_IntSize(vFanins) );
+        Vec_IntPush( vMarks, Type );
+        for ( k = 0; k < nFanins; k++ )
+        {
+            if ( !Io_StateGetI( vIn, &Pos, &Lit ) || Abc_Lit2Var(Lit) >= nObjs || (!fStrash && Abc_LitIsCompl(Lit)) )
+                { pError = "The fanin is invalid."; goto finish; }
+            Vec_IntPush( vFanins, Lit );
+        }
+        if ( (pName = Io_StateGetS( vIn, &Pos )) == NULL )
+            { pError = "The object name is truncated."; goto finish; }
+        if ( Type == ABC_OBJ_CONST1 )
+            pObj = Abc_AigConst1( pNtk );
+        else if ( fStrash && Type == ABC_OBJ_NODE )
+        {
+            // the AIG nodes are written in the topological order
+            int * pLits = Vec_IntEntryP( vFanins, Vec_IntEntryLast(vStarts) );
+            if ( Abc_Lit2Var(pLits[0]) >= i || Abc_Lit2Var(pLits[1]) >= i )
+                { pError = "The AIG nodes are not in a topological order."; goto finish; }
+            pFanin0 = Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, Abc_Lit2Var(pLits[0])), Abc_LitIsCompl(pLits[0]) );
+            pFanin1 = Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, Abc_Lit2Var(pLits[1])), Abc_LitIsCompl(pLits[1]) );
+            if ( !Io_StateFaninIsValid(ABC_OBJ_NODE, pFanin0) || !Io_StateFaninIsValid(ABC_OBJ_NODE, pFanin1) )
+                { pError = "The AIG node has an invalid fanin."; goto finish; }
+            pObj = Abc_AigAnd( (Abc_Aig_t *)pNtk->pManFunc, pFanin0, pFanin1 );
+        }
+        else
+            pObj = Abc_NtkCreateObj( pNtk, (Abc_ObjType_t)Type );
+        Vec_PtrPush( vObjs, pObj );
+        if ( *pName )
+            Abc_ObjAssignName( Abc_ObjRegular(pObj), pName, NULL );
+        if ( Type == ABC_OBJ_LATCH )
+        {
+            if ( !Io_StateGetI( vIn, &Pos, &Init ) || Init > ABC_INIT_DC )
+                { pError = "The latch initial value is invalid."; goto finish; }
+            pObj->pData = (void *)(ABC_PTRINT_T)Init;
+        }
+        else if ( Type == ABC_OBJ_NODE && ntkFunc == ABC_FUNC_SOP )
+        {
+            if ( (pName = Io_StateGetS( vIn, &Pos )) == NULL )
+                { pError = "The node function is truncated."; goto finish; }
+            pObj->pData = Abc_SopRegister( (Mem_Flex_t *)pNtk->pManFunc, pName );
+        }
+        else if ( Type == ABC_OBJ_NODE && ntkFunc == ABC_FUNC_MAP )
+        {
+            pName    = Io_StateGetS( vIn, &Pos );
+            pOutName = pName ? Io_StateGetS( vIn, &Pos ) : NULL;
+            if ( pOutName == NULL )
+                { pError = "The gate name is truncated."; goto finish; }
+            if ( *pName == 0 )
+                continue;
+            pObj->pData = Mio_LibraryReadGateByName( pLib, pName, pOutName );
+            if ( pObj->pData == NULL )
+            {
+                printf( "Io_StateReadNtk(): Cannot find gate \"%s\" in the current library.\n", pName );
+                goto finish;
+            }
+        }
+    }
+    Vec_IntPush( vStarts, Vec_IntSize(vFanins) );
+    // connect the remaining objects
+    // (an AIG node may have been hashed into another object, so its type is taken from the data)
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+    {
+        if ( fStrash && Vec_IntEntry(vMarks, i) == ABC_OBJ_NODE )
+            continue;
+        for ( k = Vec_IntEntry(vStarts, i); k < Vec_IntEntry(vStarts, i+1); k++ )
+        {
+            pFanin0 = Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, Abc_Lit2Var(Vec_IntEntry(vFanins, k))), Abc_LitIsCompl(Vec_IntEntry(vFanins, k)) );
+            if ( !Io_StateFaninIsValid(pObj->Type, pFanin0) )
+                { pError = "The object has a fanin of a wrong type."; goto finish; }
+            Abc_ObjAddFanin( pObj, pFanin0 );
+        }
+    }
+    // each latch should be the only fanout of its input and the only fanin of its output
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( Abc_ObjIsLatch(pObj) && (Abc_ObjFanoutNum(pObj) != 1 || Abc_ObjFanoutNum(Abc_ObjFanin0(pObj)) != 1) )
+            { pError = "The latch is not connected to its input and output."; goto finish; }
+    // restore the order of the terminals and the boxes
+    vTerms[0] = pNtk->vPis;
+    vTerms[1] = pNtk->vPos;
+    vTerms[2] = pNtk->vCis;
+    vTerms[3] = pNtk->vCos;
+    vTerms[4] = pNtk->vBoxes;
+    Vec_IntFill( vMarks, Abc_NtkObjNumMax(pNtk), 0 );
+    for ( t = 0; t < 5; t++ )
+    {
+        if ( !Io_StateGetI( vIn, &Pos, &nTerms ) || nTerms != Vec_PtrSize(vTerms[t]) )
+            { pError = "The number of terminals does not match."; goto finish; }
+        Vec_PtrClear( vTerms[t] );
+        for ( i = 0; i < nTerms; i++ )
+        {
+            if ( !Io_StateGetI( vIn, &Pos, &k ) || k >= nObjs )
+                { pError = "The terminal is invalid."; goto finish; }
+            pObj = Abc_ObjRegular( (Abc_Obj_t *)Vec_PtrEntry(vObjs, k) );
+            if ( t == 0 ? !Abc_ObjIsPi(pObj) : t == 1 ? !Abc_ObjIsPo(pObj) : t == 2 ? !Abc_ObjIsCi(pObj) : t == 3 ? !Abc_ObjIsCo(pObj) : !Abc_ObjIsLatch(pObj) )
+                { pError = "The terminal has a wrong type."; goto finish; }
+            if ( Vec_IntEntry(vMarks, Abc_ObjId(pObj)) == t + 1 )
+                { pError = "The terminal is listed twice."; goto finish; }
+            Vec_IntWriteEntry( vMarks, Abc_ObjId(pObj), t + 1 );
+            Vec_PtrPush( vTerms[t], pObj );
+        }
+    }
+    if ( Pos != Vec_StrSize(vIn) )
+        { pError = "The network data has trailing bytes."; goto finish; }
+    if ( !Abc_NtkCheck( pNtk ) )
+        { pError = "The network check has failed."; goto finish; }
+    Vec_PtrFree( vObjs );
+    Vec_IntFree( vFanins );
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vMarks );
+    return pNtk;
+finish:
+    if ( pError )
+        printf( "Io_StateReadNtk(): %s\n", pError );
+    if ( vObjs )   Vec_PtrFree( vObjs );
+    if ( vFanins ) Vec_IntFree( vFanins );
+    if ( vStarts ) Vec_IntFree( vStarts );
+    if ( vMarks )  Vec_IntFree( vMarks );
+    Abc_NtkDelete( pNtk );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one section of the snapshot.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_StateWriteSection( FILE * pFile, char * pTag, Vec_Str_t * vData, int fVerbose )
+{
+    Io_StateSect_t Sect;
+    char Zeros[8] = {0};
+    int nPad = (8 - Vec_StrSize(vData) % 8) % 8;
+    memset( &Sect, 0, sizeof(Io_StateSect_t) );
+    strncpy( Sect.Tag, pTag, 7 );
+    Sect.nBytes = (word)Vec_StrSize(vData);
+    if ( fVerbose )
+        printf( "Section %-8s %10d bytes\n", pTag, Vec_StrSize(vData) );
+    return fwrite( &Sect, sizeof(Io_StateSect_t), 1, pFile ) == 1 &&
+           (int)fwrite( Vec_StrArray(vData), 1, Vec_StrSize(vData), pFile ) == Vec_StrSize(vData) &&
+           (int)fwrite( Zeros, 1, nPad, pFile ) == nPad;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the state of the frame into a binary file.]
+
+  Description [The snapshot includes the genlib library, the Liberty
+  library, the current network and the current AIG (&-space) with all
+  the information stored in the AIGER extensions (mapping, boxes, timing,
+  equivalences, choices, etc). Each is stored in a separate section,
+  which is aligned at eight bytes, so that the file can be used in place
+  when it is memory-mapped. The network is skipped if it is a netlist or
+  has hierarchy. The logic networks whose functions are not SOPs or gates
+  are saved with SOPs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteState( Abc_Frame_t * pAbc, char * pFileName, int fVerbose )
+{
+    Io_StateHead_t Head;
+    Vec_Ptr_t * vSects = Vec_PtrAlloc( 4 );
+    Vec_Ptr_t * vTags  = Vec_PtrAlloc( 4 );
+    Vec_Str_t * vData;
+    Abc_Ntk_t * pNtk = pAbc->pNtkCur;
+    FILE * pFile;
+    int i, RetValue = 1;
+    abctime clk = Abc_Clock();
+    // collect the sections
+    if ( pAbc->pLibGen && (vData = Io_StateWriteGenlib((Mio_Library_t *)pAbc->pLibGen)) )
+        Vec_PtrPush( vSects, vData ), Vec_PtrPush( vTags, (void *)"genlib" );
+    if ( pAbc->pLibScl )
+        Vec_PtrPush( vSects, Abc_SclWriteIntoStr((SC_Lib *)pAbc->pLibScl) ), Vec_PtrPush( vTags, (void *)"scl" );
+    if ( pNtk && (Abc_NtkIsNetlist(pNtk) || Abc_NtkWhiteboxNum(pNtk) > 0 || Abc_NtkBlackboxNum(pNtk) > 0) )
+        printf( "Warning: The current network is not saved because it has hierarchy.\n" );
+    else if ( pNtk && (Abc_NtkIsStrash(pNtk) || Abc_NtkIsSopLogic(pNtk) || Abc_NtkIsMappedLogic(pNtk)) )
+        Vec_PtrPush( vSects, Io_StateWriteNtk(pNtk) ), Vec_PtrPush( vTags, (void *)"ntk" );
+    else if ( pNtk && Abc_NtkIsLogic(pNtk) )
+    {
+        Abc_Ntk_t * pNtkSop = Abc_NtkDup( pNtk );
+        Abc_NtkToSop( pNtkSop, -1, ABC_INFINITY );
+        Vec_PtrPush( vSects, Io_StateWriteNtk(pNtkSop) ), Vec_PtrPush( vTags, (void *)"ntk" );
+        Abc_NtkDelete( pNtkSop );
+    }
+    if ( pAbc->pGia && (vData = Gia_AigerWriteIntoMemoryStrExt(pAbc->pGia)) )
+        Vec_PtrPush( vSects, vData ), Vec_PtrPush( vTags, (void *)"gia" );
+    // write the file
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        RetValue = 0;
+    }
+    else
+    {
+        memset( &Head, 0, sizeof(Io_StateHead_t) );
+        strncpy( Head.Magic, IO_STATE_MAGIC, 16 );
+        Head.Version   = IO_STATE_VERSION;
+        Head.nSections = Vec_PtrSize(vSects);
+        RetValue = fwrite( &Head, sizeof(Io_StateHead_t), 1, pFile ) == 1;
+        Vec_PtrForEachEntry( Vec_Str_t *, vSects, vData, i )
+            RetValue &= Io_StateWriteSection( pFile, (char *)Vec_PtrEntry(vTags, i), vData, fVerbose );
+        RetValue &= (fclose( pFile ) == 0);
+        if ( !RetValue )
+            printf( "Writing file \"%s\" has failed.\n", pFileName );
+    }
+    Vec_PtrForEachEntry( Vec_Str_t *, vSects, vData, i )
+        Vec_StrFree( vData );
+    Vec_PtrFree( vSects );
+    Vec_PtrFree( vTags );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Saving state", Abc_Clock() - clk );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the state of the frame from a binary file.]
+
+  Description [The file is memory-mapped and the sections are restored
+  directly from the mapped pages. The libraries are restored before the
+  networks because the mapped networks refer to the gates. The parts of
+  the state not present in the snapshot are not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadState( Abc_Frame_t * pAbc, char * pFileName, int fVerbose )
+{
+    Io_StateHead_t Head;
+    Io_StateSect_t Sect;
+    Vec_Str_t vData = { 0, 0, NULL };
+    char * pBuffer = NULL;
+    word nFileBytes = 0, Pos;
+    int i, RetValue = 1;
+    abctime clk = Abc_Clock();
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd >= 0 && fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+    {
+        nFileBytes = (word)Stat.st_size;
+        pBuffer = (char *)mmap( NULL, (size_t)nFileBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+        if ( pBuffer == (char *)MAP_FAILED )
+            pBuffer = NULL;
+    }
+    if ( fd >= 0 )
+        close( fd );
+#else
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile != NULL )
+    {
+        fseek( pFile, 0, SEEK_END );
+        nFileBytes = (word)ftell( pFile );
+        rewind( pFile );
+        pBuffer = ABC_ALLOC( char, nFileBytes + 1 );
+        nFileBytes = (word)fread( pBuffer, 1, (size_t)nFileBytes, pFile );
+        fclose( pFile );
+    }
+#endif
+    if ( pBuffer == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return 0;
+    }
+    if ( nFileBytes < sizeof(Io_StateHead_t) )
+        RetValue = 0;
+    else
+    {
+        memcpy( &Head, pBuffer, sizeof(Io_StateHead_t) );
+        RetValue = !strncmp(Head.Magic, IO_STATE_MAGIC, 16) && Head.Version == IO_STATE_VERSION;
+    }
+    if ( !RetValue )
+        printf( "File \"%s\" is not an ABC state snapshot of version %d.\n", pFileName, IO_STATE_VERSION );
+    Pos = sizeof(Io_StateHead_t);
+    for ( i = 0; RetValue && i < Head.nSections; i++ )
+    {
+        if ( Pos + sizeof(Io_StateSect_t) > nFileBytes )
+        {
+            printf( "File \"%s\" is truncated.\n", pFileName );
+            RetValue = 0;
+            break;
+        }
+        memcpy( &Sect, pBuffer + Pos, sizeof(Io_StateSect_t) );
+        Pos += sizeof(Io_StateSect_t);
+        if ( Pos + Sect.nBytes > nFileBytes || Sect.nBytes >= (word)ABC_INFINITY )
+        {
+            printf( "File \"%s\" is truncated.\n", pFileName );
+            RetValue = 0;
+            break;
+        }
+        vData.nCap   = (int)Sect.nBytes;
+        vData.nSize  = (int)Sect.nBytes;
+        vData.pArray = pBuffer + Pos;
+        Pos += (Sect.nBytes + 7) / 8 * 8;
+        Sect.Tag[7] = 0;
+        if ( fVerbose )
+            printf( "Section %-8s %10d bytes\n", Sect.Tag, vData.nSize );
+        if ( !strcmp(Sect.Tag, "genlib") )
+        {
+            Mio_Library_t * pLib = Mio_LibraryRead( pFileName, vData.pArray, NULL, 0 );
+            if ( pLib == NULL )
+                RetValue = 0;
+            else
+                Mio_UpdateGenlib( pLib );
+        }
+        else if ( !strcmp(Sect.Tag, "scl") )
+        {
+            SC_Lib * pLib = Abc_SclReadFromStr( &vData );
+            if ( pLib == NULL )
+                RetValue = 0;
+            else
+                Abc_SclLoad( pLib, (SC_Lib **)&pAbc->pLibScl );
+        }
+        else if ( !strcmp(Sect.Tag, "ntk") )
+        {
+            Abc_Ntk_t * pNtk = Io_StateReadNtk( &vData );
+            if ( pNtk == NULL )
+                RetValue = 0;
+            else
+            {
+                Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
+                Abc_FrameClearVerifStatus( pAbc );
+            }
+        }
+        else if ( !strcmp(Sect.Tag, "gia") )
+        {
+            Gia_Man_t * pGia = Gia_AigerReadFromMemory( vData.pArray, vData.nSize, 0, 1, 0 );
+            if ( pGia == NULL )
+                RetValue = 0;
+            else
+                Abc_FrameUpdateGia( pAbc, pGia );
+        }
+        else
+            printf( "Skipping unknown section \"%s\".\n", Sect.Tag );
+        if ( !RetValue )
+            printf( "Restoring section \"%s\" has failed.\n", Sect.Tag );
+    }
+#ifndef _WIN32
+    munmap( pBuffer, (size_t)nFileBytes );
+#else
+    ABC_FREE( pBuffer );
+#endif
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Loading state", Abc_Clock() - clk );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -22,6 +22,17 @@
 #include "map/mio/mio.h"
 #include "base/main/main.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -55,6 +66,7 @@ static Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib );
 static void Ver_ParseStop( Ver_Man_t * p );
 static void Ver_ParseFreeData( Ver_Man_t * p );
 static void Ver_ParseInternal( Ver_Man_t * p );
+static int  Ver_ParseLink( Ver_Man_t * p );
 static int  Ver_ParseModule( Ver_Man_t * p );
 static int  Ver_ParseSignal( Ver_Man_t * p, Abc_Ntk_t * pNtk, Ver_SignalType_t SigType );
 static int  Ver_ParseAlways( Ver_Man_t * p, Abc_Ntk_t * pNtk );
@@ -75,9 +87,13 @@ static Abc_Obj_t * Ver_ParseCreateInv( Abc_Ntk_t * pNtk, Abc_Obj_t * pNet );
 static void Ver_ParseRemoveSuffixTable( Ver_Man_t * pMan );
 
 static inline int Ver_NtkIsDefined( Abc_Ntk_t * pNtkBox )  { assert( pNtkBox->pName );     return Abc_NtkPiNum(pNtkBox) || Abc_NtkPoNum(pNtkBox);  }
+static inline int Ver_ParseIsNameChar( char c )           { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_'; }
 static inline int Ver_ObjIsConnected( Abc_Obj_t * pObj )   { assert( Abc_ObjIsBox(pObj) ); return Abc_ObjFaninNum(pObj) || Abc_ObjFanoutNum(pObj); }
 
 int glo_fMapped = 0; // this is bad!
+int glo_nThreads = 1; // the number of threads used to read mapped Verilog
+
+#define VER_THR_MAX 64
 
 typedef struct Ver_Bundle_t_    Ver_Bundle_t;
 struct Ver_Bundle_t_
@@ -166,6 +182,9 @@ Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, i
 {
     Ver_Man_t * p;
     Abc_Des_t * pDesign;
+    // the modules of mapped Verilog can be parsed concurrently
+    if ( glo_fMapped && glo_nThreads > 1 )
+        return Ver_ParseFilePar( pFileName, pGateLib, fCheck, fUseMemMan, glo_nThreads );
     // start the parser
     p = Ver_ParseStart( pFileName, pGateLib );
     p->fMapped    = glo_fMapped;
@@ -199,9 +218,7 @@ Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, i
 ***********************************************************************/
 void Ver_ParseInternal( Ver_Man_t * pMan )
 {
-    Abc_Ntk_t * pNtk;
     char * pToken;
-    int i;
 
     // preparse the modeles
     pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
@@ -224,9 +241,29 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     Extra_ProgressBarStop( pMan->pProgress );
     pMan->pProgress = NULL;
 
+    // connect the boxes and check the modules
+    Ver_ParseLink( pMan );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Connects the boxes and checks the modules.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseLink( Ver_Man_t * pMan )
+{
+    Abc_Ntk_t * pNtk;
+    int i;
+
     // process defined and undefined boxes
     if ( !Ver_ParseAttachBoxes( pMan ) )
-        return;
+        return 0;
 
     // connect the boxes and check
     Vec_PtrForEachEntry( Abc_Ntk_t *, pMan->pDesign->vModules, pNtk, i )
@@ -239,9 +276,312 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
             pMan->fTopLevel = 1;
             sprintf( pMan->sError, "The network check has failed for network %s.", pNtk->pName );
             Ver_ParsePrintErrorMessage( pMan );
-            return;
+            return 0;
         }
     }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the beginnings of the modules in the file.]
+
+  Description [Skips the comments, the strings and the escaped names.
+  Records the offset and the line number of each "module" keyword.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ver_ParseSplitModules( char * pBuffer, int nSize, Vec_Int_t * vStarts, Vec_Int_t * vLines )
+{
+    char * pCur = pBuffer, * pEnd = pBuffer + nSize, * pWord;
+    int iLine = 1;
+    while ( pCur < pEnd )
+    {
+        if ( *pCur == '\n' )
+            iLine++, pCur++;
+        else if ( pCur[0] == '/' && pCur + 1 < pEnd && pCur[1] == '/' )
+        {
+            while ( pCur < pEnd && *pCur != '\n' )
+                pCur++;
+        }
+        else if ( pCur[0] == '/' && pCur + 1 < pEnd && pCur[1] == '*' )
+        {
+            for ( pCur += 2; pCur < pEnd && !(pCur[0] == '*' && pCur + 1 < pEnd && pCur[1] == '/'); pCur++ )
+                iLine += (*pCur == '\n');
+            pCur += 2;
+        }
+        else if ( *pCur == '\"' )
+        {
+            for ( pCur++; pCur < pEnd && *pCur != '\"'; pCur++ )
+                iLine += (*pCur == '\n');
+            pCur++;
+        }
+        else if ( *pCur == '\\' )
+        {
+            while ( pCur < pEnd && *pCur != ' ' && *pCur != '\t' && *pCur != '\r' && *pCur != '\n' )
+                pCur++;
+        }
+        else if ( Ver_ParseIsNameChar(*pCur) )
+        {
+            pWord = pCur;
+            while ( pCur < pEnd && (Ver_ParseIsNameChar(*pCur) || *pCur == '$') )
+                pCur++;
+            if ( pCur - pWord == 6 && !strncmp(pWord, "module", 6) )
+            {
+                Vec_IntPush( vStarts, pWord - pBuffer );
+                Vec_IntPush( vLines, iLine );
+            }
+        }
+        else
+            pCur++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules in one part of the file.]
+
+  Description [The boxes are connected to the modules of the part, which
+  are empty if the module is defined in another part.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParsePart( Ver_Man_t * pMan )
+{
+    char * pToken;
+    while ( 1 )
+    {
+        pToken = Ver_ParseGetName( pMan );
+        if ( pToken == NULL )
+            break;
+        if ( strcmp( pToken, "module" ) )
+        {
+            sprintf( pMan->sError, "Cannot read \"module\" directive." );
+            Ver_ParsePrintErrorMessage( pMan );
+            return 0;
+        }
+        if ( !Ver_ParseModule(pMan) )
+            return 0;
+    }
+    return pMan->pDesign != NULL;
+}
+#ifdef ABC_USE_PTHREADS
+void * Ver_ParseWorker( void * pArg )
+{
+    Ver_Man_t * pMan = (Ver_Man_t *)pArg;
+    if ( !Ver_ParsePart( pMan ) && pMan->pDesign )
+        Ver_ParseFreeData( pMan );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Merges the modules parsed in the parts into one design.]
+
+  Description [Moves the modules defined in the parts into the new design
+  in the order of the file, followed by the undefined modules. Redirects 
+  the boxes to the modules of the new design and deletes the remaining
+  empty modules of the parts. Returns NULL if a module is defined twice.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Des_t * Ver_ParseMergeParts( Ver_Man_t ** pMans, int nParts, char * pFileName, char * pError )
+{
+    Abc_Des_t * pDesign, * pPart;
+    Abc_Ntk_t * pNtk, * pNtkNew;
+    Abc_Obj_t * pBox;
+    int i, k, j, fError = 0;
+    pDesign = Abc_DesCreate( pFileName );
+    pDesign->pLibrary = pMans[0]->pDesign->pLibrary;
+    pDesign->pGenlib  = pMans[0]->pDesign->pGenlib;
+    Hop_ManStop( (Hop_Man_t *)pDesign->pManFunc );
+    pDesign->pManFunc = NULL;
+    for ( i = 0; i < nParts; i++ )
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pMans[i]->pDesign->vModules, pNtk, k )
+            pNtk->pCopy = NULL;
+    // add the defined modules
+    for ( i = 0; i < nParts && !fError; i++ )
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pMans[i]->pDesign->vModules, pNtk, k )
+        {
+            if ( Abc_NtkObjNum(pNtk) == 0 )
+                continue;
+            if ( Abc_DesFindModelByName( pDesign, pNtk->pName ) )
+            {
+                sprintf( pError, "Module %s is defined more than once.", pNtk->pName );
+                fError = 1;
+                break;
+            }
+            pNtk->Id = 0;
+            Abc_DesAddModel( pDesign, pNtk );
+            pNtk->pCopy = pNtk;
+        }
+    // add the undefined modules
+    for ( i = 0; i < nParts && !fError; i++ )
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pMans[i]->pDesign->vModules, pNtk, k )
+        {
+            if ( pNtk->pCopy != NULL )
+                continue;
+            pNtkNew = Abc_DesFindModelByName( pDesign, pNtk->pName );
+            if ( pNtkNew == NULL )
+            {
+                pNtk->Id = 0;
+                Abc_DesAddModel( pDesign, pNtk );
+                pNtkNew = pNtk;
+            }
+            pNtk->pCopy = pNtkNew;
+        }
+    // redirect the boxes
+    if ( !fError )
+    {
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pDesign->vModules, pNtk, k )
+            Abc_NtkForEachBlackbox( pNtk, pBox, j )
+                if ( pBox->pData )
+                    pBox->pData = ((Abc_Ntk_t *)pBox->pData)->pCopy;
+    }
+    // delete the parts without the modules of the new design
+    for ( i = 0; i < nParts; i++ )
+    {
+        pPart = pMans[i]->pDesign;
+        j = 0;
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pPart->vModules, pNtk, k )
+            if ( pNtk->pCopy != pNtk )
+                Vec_PtrWriteEntry( pPart->vModules, j++, pNtk );
+        Vec_PtrShrink( pPart->vModules, j );
+        Abc_DesFree( pPart, NULL );
+        pMans[i]->pDesign = NULL;
+    }
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pDesign->vModules, pNtk, k )
+        pNtk->pCopy = NULL;
+    if ( fError )
+    {
+        Abc_DesFree( pDesign, NULL );
+        return NULL;
+    }
+    return pDesign;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [File parser for mapped Verilog using several threads.]
+
+  Description [Splits the file into parts containing whole modules of
+  roughly the same size. The parts are parsed concurrently, each into its
+  own design, so that the name managers of the modules are not shared.
+  The designs are then merged and the boxes are connected serially.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Des_t * Ver_ParseFilePar( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan, int nThreads )
+{
+    Ver_Man_t * pMans[VER_THR_MAX];
+    Ver_Man_t * p;
+    Abc_Des_t * pDesign = NULL;
+    Vec_Int_t * vStarts, * vLines, * vParts;
+    char * pBuffer;
+    int i, iStart, iStop, nSize, nParts, fError = 0;
+    // read the file
+    pBuffer = Extra_FileReadContents( pFileName );
+    if ( pBuffer == NULL )
+    {
+        printf( "Ver_ParseFilePar(): Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    nSize = Extra_FileSize( pFileName );
+    // find the modules and divide them into parts
+    vStarts = Vec_IntAlloc( 100 );
+    vLines  = Vec_IntAlloc( 100 );
+    Ver_ParseSplitModules( pBuffer, nSize, vStarts, vLines );
+    nThreads = Abc_MinInt( nThreads, VER_THR_MAX );
+    nThreads = Abc_MaxInt( Abc_MinInt( nThreads, Vec_IntSize(vStarts) ), 1 );
+    vParts = Vec_IntAlloc( nThreads + 1 );
+    Vec_IntPush( vParts, 0 );
+    for ( i = 1; i < Vec_IntSize(vStarts); i++ )
+        if ( Vec_IntEntry(vStarts, i) >= (int)((double)nSize * Vec_IntSize(vParts) / nThreads) )
+            Vec_IntPush( vParts, i );
+    nParts = Vec_IntSize(vParts);
+    // start the parsers of the parts
+    for ( i = 0; i < nParts; i++ )
+    {
+        iStart = i ? Vec_IntEntry(vStarts, Vec_IntEntry(vParts, i)) : 0;
+        iStop  = i < nParts - 1 ? Vec_IntEntry(vStarts, Vec_IntEntry(vParts, i+1)) : nSize;
+        p = ABC_CALLOC( Ver_Man_t, 1 );
+        p->pFileName  = pFileName;
+        p->pReader    = Ver_StreamAllocMem( pFileName, pBuffer + iStart, iStop - iStart, i ? Vec_IntEntry(vLines, Vec_IntEntry(vParts, i)) : 1 );
+        p->Output     = stdout;
+        p->vNames     = Vec_PtrAlloc( 100 );
+        p->vStackFn   = Vec_PtrAlloc( 100 );
+        p->vStackOp   = Vec_IntAlloc( 100 );
+        p->vPerm      = Vec_IntAlloc( 100 );
+        p->pDesign    = Abc_DesCreate( pFileName );
+        p->pDesign->pLibrary = pGateLib;
+        p->pDesign->pGenlib  = Abc_FrameReadLibGen();
+        Hop_ManStop( (Hop_Man_t *)p->pDesign->pManFunc );
+        p->pDesign->pManFunc = NULL;
+        p->fMapped    = 1;
+        p->fCheck     = fCheck;
+        p->fUseMemMan = fUseMemMan;
+        pMans[i] = p;
+    }
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vLines );
+    Vec_IntFree( vParts );
+    ABC_FREE( pBuffer );
+    // parse the parts
+#ifdef ABC_USE_PTHREADS
+    if ( nParts > 1 )
+    {
+        pthread_t WorkerThread[VER_THR_MAX];
+        int status;
+        for ( i = 0; i < nParts; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Ver_ParseWorker, (void *)pMans[i] );  assert( status == 0 );
+        }
+        for ( i = 0; i < nParts; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+    }
+    else
+#endif
+    for ( i = 0; i < nParts; i++ )
+        if ( !Ver_ParsePart( pMans[i] ) && pMans[i]->pDesign )
+            Ver_ParseFreeData( pMans[i] );
+    for ( i = 0; i < nParts; i++ )
+        fError |= (pMans[i]->pDesign == NULL);
+    // merge the parts and connect the boxes
+    if ( !fError )
+    {
+        p = pMans[0];
+        p->fTopLevel = 1;
+        p->pDesign = Ver_ParseMergeParts( pMans, nParts, pFileName, p->sError );
+        if ( p->pDesign == NULL )
+            Ver_ParsePrintErrorMessage( p );
+        else
+            Ver_ParseLink( p );
+        pDesign = p->pDesign;
+        p->pDesign = NULL;
+    }
+    for ( i = 0; i < nParts; i++ )
+    {
+        Ver_ParseFreeData( pMans[i] );
+        Ver_ParseStop( pMans[i] );
+    }
+    return pDesign;
 }
 
 /**Function*************************************************************
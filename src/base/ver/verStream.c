@@ -110,6 +110,40 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the reader for the part of the file already in memory.]
+
+  Description [The characters are copied, so the reader does not depend
+  on the buffer. The line counter starts from the given line number.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pData, int nData, int iLineStart )
+{
+    Ver_Stream_t * p;
+    p = ABC_ALLOC( Ver_Stream_t, 1 );
+    memset( p, 0, sizeof(Ver_Stream_t) );
+    p->pFileName   = pFileName;
+    p->pFile       = NULL;
+    p->nFileSize   = nData;
+    p->nFileRead   = nData;
+    // copy the data into the buffer
+    p->pBuffer     = ABC_ALLOC( char, nData+1 );
+    memcpy( p->pBuffer, pData, (size_t)nData );
+    p->pBuffer[nData] = 0;
+    p->nBufferSize = nData;
+    // the data is loaded completely
+    p->pBufferCur  = p->pBuffer;
+    p->pBufferEnd  = p->pBuffer + nData;
+    p->pBufferStop = p->pBufferEnd;
+    p->nLineCounter = iLineStart;
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Loads new data into the file reader.]
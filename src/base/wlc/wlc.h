@@ -213,6 +213,7 @@ struct Wlc_BstPar_t_
     int                    fNoCleanup;
     int                    fCreateMiter;
     int                    fDecMuxes;
+    int                    fUseCache;
     int                    fVerbose;
     Vec_Int_t *            vBoxIds;
 };
@@ -231,6 +232,7 @@ static inline void Wlc_BstParDefault( Wlc_BstPar_t * pPar )
     pPar->fCla         =  0;
     pPar->fCreateMiter =  0;
     pPar->fDecMuxes    =  0;
+    pPar->fUseCache    =  1;
     pPar->fVerbose     =  0;
 }
 
@@ -402,6 +404,7 @@ extern void           Wlc_NtkPrintNode( Wlc_Ntk_t * p, Wlc_Obj_t * pObj );
 extern void           Wlc_NtkPrintNodeArray( Wlc_Ntk_t * p, Vec_Int_t * vArray );
 extern void           Wlc_NtkPrintNodes( Wlc_Ntk_t * p, int Type );
 extern void           Wlc_NtkPrintStats( Wlc_Ntk_t * p, int fDistrib, int fTwoSides, int fVerbose );
+extern void           Wlc_NtkPrintBlastProfile( Wlc_Ntk_t * p, int * pHits, abctime * pTimes, abctime clkTotal );
 extern void           Wlc_NtkPrintObjects( Wlc_Ntk_t * p );
 extern void           Wlc_NtkTransferNames( Wlc_Ntk_t * pNew, Wlc_Ntk_t * p );
 extern char *         Wlc_NtkNewName( Wlc_Ntk_t * p, int iCoId, int fSeq );
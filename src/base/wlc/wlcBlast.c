@@ -20,6 +20,7 @@
 
 #include "wlc.h"
 #include "misc/tim/tim.h"
+#include "misc/vec/vecHsh.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1115,11 +1116,57 @@ void Wlc_BlastBooth( Gia_Man_t * pNew, int * pArgA, int * pArgB, int nArgA, int
     Vec_IntFree( vArgB );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the key of the operator for reusing blasted results.]
+
+  Description [Returns 0 if the operator is not worth caching. The key
+  is composed of the type, the range and the signedness of the operator,
+  followed by the signedness, the range and the bit literals of each fanin.
+  Two operators with the same key have the same bit-level implementation,
+  in particular, this is true when they have the same constant fanins.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Wlc_NtkBlastCacheKey( Wlc_Ntk_t * p, Wlc_Obj_t * pObj, Vec_Int_t * vKey )
+{
+    Wlc_Obj_t * pFanin;
+    int k, b, iFanin, nRange, * pFans;
+    if ( !(pObj->Type == WLC_OBJ_MUX || pObj->Type == WLC_OBJ_ARI_ADDSUB || pObj->Type == WLC_OBJ_DEC ||
+          (pObj->Type >= WLC_OBJ_SHIFT_R  && pObj->Type <= WLC_OBJ_ROTATE_L)     || 
+          (pObj->Type >= WLC_OBJ_COMP_EQU && pObj->Type <= WLC_OBJ_COMP_MOREEQU) || 
+          (pObj->Type >= WLC_OBJ_ARI_ADD  && pObj->Type <= WLC_OBJ_ARI_SQUARE)) )
+        return 0;
+    Vec_IntClear( vKey );
+    Vec_IntPush( vKey, pObj->Type );
+    Vec_IntPush( vKey, Wlc_ObjRange(pObj) );
+    Vec_IntPush( vKey, pObj->Signed );
+    Wlc_ObjForEachFanin( pObj, iFanin, k )
+    {
+        pFanin = Wlc_NtkObj( p, iFanin );
+        nRange = Wlc_ObjRange( pFanin );
+        pFans  = Vec_IntEntryP( &p->vBits, Wlc_ObjCopy(p, iFanin) );
+        Vec_IntPush( vKey, pFanin->Signed );
+        Vec_IntPush( vKey, nRange );
+        for ( b = 0; b < nRange; b++ )
+            Vec_IntPush( vKey, pFans[b] );
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
 
-  Description []
+  Description [Blasts the operators in the topological order directly into
+  the hashed AIG. The results of operators are reused for other operators
+  with the same key (see Wlc_NtkBlastCacheKey), which saves the runtime
+  when the design has replicated multipliers, dividers, etc. If verbose,
+  prints the number of objects, reused objects, AND-nodes and runtime for
+  each type of the operators.]
                
   SideEffects []
 
@@ -1142,6 +1189,10 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     int i, k, b, iFanin, iLit, nAndPrev, * pFans0, * pFans1, * pFans2, * pFans3;
     int nFFins = 0, nFFouts = 0, curPi = 0, curPo = 0;
     int nBitCis = 0, nBitCos = 0, fAdded = 0;
+    int iKey, iCached, nHits[WLC_OBJ_NUMBER] = {0};
+    abctime clk, clkTotal = Abc_Clock(), clkTypes[WLC_OBJ_NUMBER] = {0};
+    Hsh_VecMan_t * pCache = NULL;
+    Vec_Int_t * vCacheObjs = NULL, * vKey = NULL;
     Wlc_BstPar_t Par, * pPar = &Par;
     Wlc_BstParDefault( pPar );
     pPar = pParIn ? pParIn : pPar;
@@ -1151,6 +1202,13 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     vTemp1 = Vec_IntAlloc( 1000 );
     vTemp2 = Vec_IntAlloc( 1000 );
     vRes   = Vec_IntAlloc( 1000 );
+    // start the cache of blasted operators
+    if ( pPar->fUseCache && !pPar->fGiaSimple )
+    {
+        pCache     = Hsh_VecManStart( 1000 );
+        vCacheObjs = Vec_IntAlloc( 1000 );
+        vKey       = Vec_IntAlloc( 1000 );
+    }
     // clean AND-gate counters
     memset( p->nAnds, 0, sizeof(int) * WLC_OBJ_NUMBER );
     // create AIG manager
@@ -1204,6 +1262,7 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
 //        char * pName1 = Wlc_ObjName(p, i);
 //        char * pName2 = Wlc_ObjFaninNum(pObj) ? Wlc_ObjName(p, Wlc_ObjFaninId0(pObj)) : NULL;
 
+        clk = pPar->fVerbose ? Abc_Clock() : 0;
         nAndPrev = Gia_ManAndNum(pNew);
         nRange  = Wlc_ObjRange( pObj );
         nRange0 = Wlc_ObjFaninNum(pObj) > 0 ? Wlc_ObjRange( Wlc_ObjFanin0(p, pObj) ) : -1;
@@ -1216,7 +1275,24 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
         pFans3  = Wlc_ObjFaninNum(pObj) > 3 ? Vec_IntEntryP( vBits, Wlc_ObjCopy(p, Wlc_ObjFaninId(pObj,3)) ) : NULL;
         Vec_IntClear( vRes );
         assert( nRange > 0 );
-        if ( pPar->vBoxIds && pObj->Mark )
+        // check if the same operator was already blasted
+        iCached = -1;
+        if ( pCache && !(pPar->vBoxIds && pObj->Mark) && Wlc_NtkBlastCacheKey(p, pObj, vKey) )
+        {
+            iKey = Hsh_VecManAdd( pCache, vKey );
+            if ( iKey < Vec_IntSize(vCacheObjs) )
+                iCached = Vec_IntEntry( vCacheObjs, iKey );
+            else
+                Vec_IntPush( vCacheObjs, i );
+        }
+        if ( iCached >= 0 )
+        {
+            pFans0 = Vec_IntEntryP( vBits, Wlc_ObjCopy(p, iCached) );
+            for ( k = 0; k < nRange; k++ )
+                Vec_IntPush( vRes, pFans0[k] );
+            nHits[pObj->Type]++;
+        }
+        else if ( pPar->vBoxIds && pObj->Mark )
         {
             If_Box_t * pBox;
             char Buffer[100];
@@ -1760,9 +1836,19 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
             Vec_IntPush( vAddObjs, Wlc_ObjId(p, pObj) );
         }
         p->nAnds[pObj->Type] += Gia_ManAndNum(pNew) - nAndPrev;
+        if ( pPar->fVerbose )
+            clkTypes[pObj->Type] += Abc_Clock() - clk;
     }
     p->nAnds[0] = Gia_ManAndNum(pNew);
     assert( nBits == Vec_IntSize(vBits) );
+    if ( pPar->fVerbose )
+        Wlc_NtkPrintBlastProfile( p, nHits, clkTypes, Abc_Clock() - clkTotal );
+    if ( pCache )
+    {
+        Hsh_VecManStop( pCache );
+        Vec_IntFree( vCacheObjs );
+        Vec_IntFree( vKey );
+    }
     Vec_IntFree( vTemp0 );
     Vec_IntFree( vTemp1 );
     Vec_IntFree( vTemp2 );
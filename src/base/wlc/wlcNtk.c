@@ -733,6 +733,21 @@ void Wlc_NtkPrintStats( Wlc_Ntk_t * p, int fDistrib, int fTwoSides, int fVerbose
             printf( "%2d  :  %-8s  %6d\n", i, Wlc_Names[i], p->nObjs[i] );
     }
 }
+void Wlc_NtkPrintBlastProfile( Wlc_Ntk_t * p, int * pHits, abctime * pTimes, abctime clkTotal )
+{
+    int i;
+    printf( "Bit-blasting profile:\n" );
+    printf( "    :  Type        Objs    Reused      ANDs   ANDs %%     Time\n" );
+    for ( i = 1; i < WLC_OBJ_NUMBER; i++ )
+    {
+        if ( !p->nObjs[i] )
+            continue;
+        printf( "%2d  :  %-8s  %6d  %8d  %8d  %6.2f %%  %6.2f sec\n", i, Wlc_Names[i], p->nObjs[i], pHits[i], p->nAnds[i], 
+            p->nAnds[0] ? 100.0*p->nAnds[i]/p->nAnds[0] : 0.0, 1.0*((double)(pTimes[i]))/((double)CLOCKS_PER_SEC) );
+    }
+    printf( "Total AIG nodes = %d.  ", p->nAnds[0] );
+    Abc_PrintTime( 1, "Total time", clkTotal );
+}
 void Wlc_NtkPrintObjects( Wlc_Ntk_t * p )
 {
     Wlc_Obj_t * pObj; int i;
@@ -20,6 +20,7 @@
 
 #include "wlc.h"
 #include "misc/vec/vecWec.h"
+#include "misc/vec/vecHsh.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -41,9 +42,18 @@ struct Smt_Prs_t_
     Vec_Int_t    vStack;      // current node on each level
     //Vec_Wec_t    vDepth;      // objects on each level
     Vec_Wec_t    vObjs;       // objects
+    Vec_Int_t    vArena;      // fanins of all objects (storage for vObjs)
     int          NameCount;
     int          nDigits;
     Vec_Int_t    vTempFans; 
+    Vec_Int_t    vFanStack;   // fanins of the nodes being built
+    Vec_Str_t    vName;       // temporary name
+    Vec_Int_t    vTokTypes;   // operator type of each token (1 + 2*Type + fSigned)
+    Vec_Int_t    vTokObjs;    // global object of each token
+    // structural hashing
+    Hsh_VecMan_t * pHash;     // hash table of created nodes
+    Vec_Int_t    vHashKey;    // temporary key
+    Vec_Int_t    vHashObjs;   // node created for each key
     // error handling
     char ErrorStr[1000];     
 };
@@ -310,7 +320,8 @@ static inline int Smt_PrsCreateNode( Wlc_Ntk_t * pNtk, int Type, int fSigned, in
     char * pNameFanin;
     int NameId, fFound, old_size, new_size;
     int iObj, iFanin0, iFanin1; 
-    Vec_Int_t * v2Fanins = Vec_IntStartFull(2);
+    int p2Fanins[2] = { -1, -1 };
+    Vec_Int_t v2FaninsTemp = { 2, 2, p2Fanins }, * v2Fanins = &v2FaninsTemp;
     
     assert( Type > 0 );
     assert( Range >= 0 );
@@ -373,8 +384,6 @@ static inline int Smt_PrsCreateNode( Wlc_Ntk_t * pNtk, int Type, int fSigned, in
     
 FINISHED_WITH_FANINS:
 
-    Vec_IntFree(v2Fanins);
-    
     //added to deal with long shifts create extra bit select (ROTATE as well ??)
     // this is a temporary hack
     // basically we keep only 32 bits. 
@@ -479,6 +488,49 @@ FINISHED_WITH_FANINS:
     return iObj;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates the node unless a structurally identical one exists.]
+
+  Description [Terms shared in the SMT-LIB file, such as repeated 
+  subexpressions or constants, are hashed on the node type, range, and 
+  fanins, so that each of them becomes one Wlc_Obj_t. If the name is given 
+  and the node exists, a buffer with this name is created.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Smt_PrsGenName( Smt_Prs_t * p )
+{
+    static char Buffer[16];
+    sprintf( Buffer, "_%0*X_", p->nDigits, ++p->NameCount );
+    return Buffer;
+}
+static inline int Smt_PrsCreateNodeHash( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int Type, int fSigned, int Range, Vec_Int_t * vFanins, char * pName )
+{
+    int iEntry, nEntries, iObj;
+    if ( p->pHash == NULL )
+        return Smt_PrsCreateNode( pNtk, Type, fSigned, Range, vFanins, pName );
+    Vec_IntClear( &p->vHashKey );
+    Vec_IntPushThree( &p->vHashKey, Type, fSigned, Range );
+    Vec_IntAppend( &p->vHashKey, vFanins );
+    nEntries = Hsh_VecSize( p->pHash );
+    iEntry = Hsh_VecManAdd( p->pHash, &p->vHashKey );
+    if ( iEntry < nEntries )
+    {
+        iObj = Vec_IntEntry( &p->vHashObjs, iEntry );
+        if ( pName == NULL )
+            return iObj;
+        Vec_IntFill( &p->vTempFans, 1, iObj );
+        return Smt_PrsCreateNode( pNtk, WLC_OBJ_BUF, 0, Wlc_ObjRange(Wlc_NtkObj(pNtk, iObj)), &p->vTempFans, pName );
+    }
+    iObj = Smt_PrsCreateNode( pNtk, Type, fSigned, Range, vFanins, pName ? pName : Smt_PrsGenName(p) );
+    Vec_IntPush( &p->vHashObjs, iObj );
+    return iObj;
+}
+
 static inline char * Smt_GetHexFromDecimalString(char * pStr)
 {
     int i,k=0, nDigits = strlen(pStr);
@@ -581,7 +633,7 @@ static inline char * Smt_GetHexFromDecimalString(char * pStr)
     return hex;
 }           
     
-static inline int Smt_PrsBuildConstant( Wlc_Ntk_t * pNtk, char * pStr, int nBits, char * pName )
+static inline int Smt_PrsBuildConstant( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, char * pStr, int nBits, char * pName )
 {
     int i, nDigits, iObj;
     Vec_Int_t * vFanins = Vec_IntAlloc( 10 );
@@ -660,7 +712,7 @@ static inline int Smt_PrsBuildConstant( Wlc_Ntk_t * pNtk, char * pStr, int nBits
         return 0;
     }
     // create constant node
-    iObj = Smt_PrsCreateNode( pNtk, WLC_OBJ_CONST, 0, nBits, vFanins, pName );
+    iObj = Smt_PrsCreateNodeHash( pNtk, p, WLC_OBJ_CONST, 0, nBits, vFanins, pName );
     Vec_IntFree( vFanins );
     return iObj;
 }
@@ -672,7 +724,7 @@ int Smt_PrsBuildNode( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int RangeOut,
         if ( (pStr[0] >= '0' && pStr[0] <= '9') || pStr[0] == '#' )
         { 
             // (_ BitVec 8) #x19
-            return Smt_PrsBuildConstant( pNtk, pStr, RangeOut, pName );
+            return Smt_PrsBuildConstant( pNtk, p, pStr, RangeOut, pName );
         }
         else
         {
@@ -692,7 +744,7 @@ int Smt_PrsBuildNode( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int RangeOut,
             // (_ bv1 32)
             char * pStr2 = Smt_VecEntryName( p, vFans, 2 );
             assert( Vec_IntSize(vFans) == 3 );
-            return Smt_PrsBuildConstant( pNtk, pStr1+2, atoi(pStr2), pName );
+            return Smt_PrsBuildConstant( pNtk, p, pStr1+2, atoi(pStr2), pName );
         }
         else if ( pStr0 && pStr0[0] == '=' )
         {
@@ -710,7 +762,7 @@ int Smt_PrsBuildNode( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int RangeOut,
             {
                 Vec_Int_t * vFanins = Vec_IntAlloc( 2 );
                 // get the constant
-                int iObj, iOper, iConst = Smt_PrsBuildConstant( pNtk, pStr0, -1, NULL );
+                int iObj, iOper, iConst = Smt_PrsBuildConstant( pNtk, p, pStr0, -1, NULL );
                 // check the middle one is an operator
                 iNode = Vec_IntEntry(vFans, 1);
                 iOper = Smt_PrsBuildNode( pNtk, p, iNode, -1, pName );
@@ -749,7 +801,7 @@ int Smt_PrsBuildNode( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int RangeOut,
                 char Buffer[10];
                 assert( Value1 >= 0 );
                 sprintf( Buffer, "%d", Value1 ); 
-                NameId = Smt_PrsBuildConstant( pNtk, Buffer, -1, NULL );
+                NameId = Smt_PrsBuildConstant( pNtk, p, Buffer, -1, NULL );
                 Vec_IntPush( vFanins, NameId );
             }
             // find range
@@ -887,7 +939,7 @@ Wlc_Ntk_t * Smt_PrsBuild( Smt_Prs_t * p )
             else if ( !strcmp("true", pValue) )
                 pValue = "#b1";
             else assert( 0 );
-            Status = Smt_PrsBuildConstant( pNtk, pValue, Range, pName );
+            Status = Smt_PrsBuildConstant( pNtk, p, pValue, Range, pName );
         }
         else
         {
@@ -1016,16 +1068,30 @@ finish:
   SeeAlso     []
 
 ***********************************************************************/
-char * Smt_PrsGenName( Smt_Prs_t * p )
+static inline int Smt_PrsTokenType( Smt_Prs_t * p, int iToken, int * pfSigned )
 {
-    static char Buffer[16];
-    sprintf( Buffer, "_%0*X_", p->nDigits, ++p->NameCount );
-    return Buffer;
+    int Value = Vec_IntEntry( &p->vTokTypes, iToken );
+    if ( Value == 0 )
+    {
+        int Type = Smt_StrToType( Abc_NamStr(p->pStrs, iToken), pfSigned );
+        Value = 1 + 2 * Type + *pfSigned;
+        Vec_IntWriteEntry( &p->vTokTypes, iToken, Value );
+    }
+    *pfSigned = (Value - 1) & 1;
+    return (Value - 1) >> 1;
+}
+static inline char * Smt_PrsAddSuffix( Smt_Prs_t * p, char * pStr, char * pSuffix, int Num )
+{
+    Vec_StrClear( &p->vName );
+    Vec_StrAppend( &p->vName, pStr );
+    Vec_StrAppend( &p->vName, pSuffix );
+    if ( Num >= 0 )
+        Vec_StrPrintNum( &p->vName, Num );
+    Vec_StrPush( &p->vName, '\0' );
+    return Vec_StrArray( &p->vName );
 }
 int Smt_PrsBuild2_rec( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int iObjPrev, char * pName )
 {
-    char suffix[100];
-    sprintf(suffix,"_as%d",pNtk->nAssert);
 
     //char * prepStr = Abc_NamStr(p->pStrs, Abc_Lit2Var(iNode));
     //printf("prestr: %s\n",prepStr);
@@ -1041,39 +1107,22 @@ int Smt_PrsBuild2_rec( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int iObjPrev,
         else if ( !strcmp(pStr, "true") )
             pStr = "#b1";
         if ( pStr[0] == '#' )
-            return Smt_PrsBuildConstant( pNtk, pStr, -1, pName ? pName : Smt_PrsGenName(p) );
+            return Smt_PrsBuildConstant( pNtk, p, pStr, -1, pName );
         else
         {
-            int fFound, iObj;
             // look either for global DECLARE-FUN variable or local LET
-            char * pStr_glb = (char *)malloc(strlen(pStr) + 4 +1); //glb
-            char * pStr_loc = (char *)malloc(strlen(pStr) + strlen(suffix) +1);
-            strcpy(pStr_glb,pStr);
-            strcat(pStr_glb,SMT_GLO_SUFFIX);
-            strcpy(pStr_loc,pStr);
-            strcat(pStr_loc,suffix);
-            
-            fFound =  Abc_NamStrFind( pNtk->pManName, pStr_glb );
-            
-            if (fFound)
-                pStr = pStr_glb;
-            else
-            {
-                assert( Abc_NamStrFind( pNtk->pManName, pStr_loc ));
-                pStr = pStr_loc;
-            }
-            // FIXME: delete memory of pStr 
-            
-            iObj = Abc_NamStrFindOrAdd( pNtk->pManName, pStr, &fFound );
-            assert( fFound );
+            int iObj = Vec_IntEntry( &p->vTokObjs, Abc_Lit2Var(iNode) );
+            if ( iObj == 0 && (iObj = Abc_NamStrFind( pNtk->pManName, Smt_PrsAddSuffix(p, pStr, SMT_GLO_SUFFIX, -1) )) )
+                Vec_IntWriteEntry( &p->vTokObjs, Abc_Lit2Var(iNode), iObj );
+            if ( iObj == 0 )
+                iObj = Abc_NamStrFind( pNtk->pManName, Smt_PrsAddSuffix(p, pStr, "_as", pNtk->nAssert) );
+            assert( iObj );
             // create buffer if the name of the fanin has different name
             if ( pName && strcmp(Wlc_ObjName(pNtk, iObj), pName) )
             {
                 Vec_IntFill( &p->vTempFans, 1, iObj );
                 iObj = Smt_PrsCreateNode( pNtk, WLC_OBJ_BUF, 0, Wlc_ObjRange(Wlc_NtkObj(pNtk, iObj)), &p->vTempFans, pName );
             }
-            ABC_FREE( pStr_glb );
-            ABC_FREE( pStr_loc );
             return iObj;
         }
     }
@@ -1110,17 +1159,9 @@ int Smt_PrsBuild2_rec( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int iObjPrev,
                     pName2 = Smt_EntryName(p, Fan3);
                     // create a local name with suffix
                     if ( Abc_Lit2Var(iRoot0) == SMT_PRS_LET )
-                    {   
-                        temp = (char *)malloc(strlen(pName2) + strlen(suffix) + 1);
-                        strcpy(temp, pName2);
-                        strcat(temp,suffix);
-                    }
+                        temp = Abc_UtilStrsav( Smt_PrsAddSuffix(p, pName2, "_as", pNtk->nAssert) );
                     else 
-                    {   temp = (char *)malloc(strlen(pName2) + 4 + 1);
-                        strcpy(temp, pName2);
-                        strcat(temp,SMT_GLO_SUFFIX);
-                    }
-                    // FIXME: need to delete memory of pName2
+                        temp = Abc_UtilStrsav( Smt_PrsAddSuffix(p, pName2, SMT_GLO_SUFFIX, -1) );
                     pName2 = temp;
                     // get function
                     Fan3 = Vec_IntEntry(vFans3, 1);
@@ -1146,7 +1187,7 @@ int Smt_PrsBuild2_rec( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int iObjPrev,
                     // (_ bv1 32)
                     char * pStr2 = Smt_VecEntryName( p, vRoots, 2 );
                     assert( Vec_IntSize(vRoots) == 3 );
-                    return Smt_PrsBuildConstant( pNtk, pStr1+2, atoi(pStr2), pName ? pName : Smt_PrsGenName(p) );
+                    return Smt_PrsBuildConstant( pNtk, p, pStr1+2, atoi(pStr2), pName );
                 }
                 else
                 {
@@ -1165,7 +1206,7 @@ int Smt_PrsBuild2_rec( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int iObjPrev,
                         //fSigned = (Type1 == WLC_OBJ_BIT_SIGNEXT);
                         if ( Type1 == WLC_OBJ_ROTATE_R || Type1 == WLC_OBJ_ROTATE_L )
                         {
-                            int iConst = Smt_PrsBuildConstant( pNtk, pStr2, -1, Smt_PrsGenName(p) );
+                            int iConst = Smt_PrsBuildConstant( pNtk, p, pStr2, -1, NULL );
                             Vec_IntClear( &p->vTempFans );
                             Vec_IntPushTwo( &p->vTempFans, iObjPrev, iConst );
                             Range = Wlc_ObjRange( Wlc_NtkObj(pNtk, iObjPrev) );
@@ -1186,34 +1227,35 @@ int Smt_PrsBuild2_rec( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int iObjPrev,
                         Vec_IntPushTwo( &p->vTempFans, Num1, Num2 );
                     }
                     else assert( 0 );
-                    iObj = Smt_PrsCreateNode( pNtk, Type1, fSigned, Range, &p->vTempFans, pName ? pName : Smt_PrsGenName(p) );
+                    iObj = Smt_PrsCreateNodeHash( pNtk, p, Type1, fSigned, Range, &p->vTempFans, pName );
                     return iObj;
                 }
             }
             else
             {
-                Vec_Int_t * vFanins;
-                int i, Fan, fSigned = 0, Range, Type0;
-                int iObj = Abc_NamStrFind( pNtk->pManName, pStr0 );
-                if ( iObj )
-                    return iObj;
-                Type0 = Smt_StrToType( pStr0, &fSigned );
+                Vec_Int_t vFaninsTemp, * vFanins = &vFaninsTemp;
+                int i, Fan, fSigned = 0, Range, Type0, iStart;
+                int iObj;
+                // built-in operators cannot be redefined, so only other tokens are looked up
+                Type0 = Smt_PrsTokenType( p, Abc_Lit2Var(iRoot0), &fSigned );
                 if ( Type0 == 0 )
-                    return 0;
+                    return Abc_NamStrFind( pNtk->pManName, pStr0 );
                 assert( Type0 != WLC_OBJ_BIT_SIGNEXT && Type0 != WLC_OBJ_BIT_ZEROPAD && Type0 != WLC_OBJ_BIT_SELECT && Type0 != WLC_OBJ_ROTATE_R && Type0 != WLC_OBJ_ROTATE_L );
 
-                // collect fanins
-                vFanins = Vec_IntAlloc( 100 );
+                // collect fanins on top of the stack shared by all nodes
+                iStart = Vec_IntSize( &p->vFanStack );
                 Vec_IntForEachEntryStart( vRoots, Fan, i, 1 )
                 {
                     iObj = Smt_PrsBuild2_rec( pNtk, p, Fan, -1, NULL );
                     if ( iObj == 0 )
                     {
-                        Vec_IntFree( vFanins );
+                        Vec_IntShrink( &p->vFanStack, iStart );
                         return 0;
                     }
-                    Vec_IntPush( vFanins, iObj );
+                    Vec_IntPush( &p->vFanStack, iObj );
                 }
+                vFanins->nSize = vFanins->nCap = Vec_IntSize(&p->vFanStack) - iStart;
+                vFanins->pArray = Vec_IntArray( &p->vFanStack ) + iStart;
                 // find range
                 Range = 0;
                 if ( Type0 >= WLC_OBJ_LOGIC_NOT && Type0 <= WLC_OBJ_REDUCT_XOR )
@@ -1238,8 +1280,8 @@ int Smt_PrsBuild2_rec( Wlc_Ntk_t * pNtk, Smt_Prs_t * p, int iNode, int iObjPrev,
                 }
                 // create node
                 assert( Range > 0 );
-                iObj = Smt_PrsCreateNode( pNtk, Type0, fSigned, Range, vFanins, pName ? pName : Smt_PrsGenName(p) );
-                Vec_IntFree( vFanins );
+                iObj = Smt_PrsCreateNodeHash( pNtk, p, Type0, fSigned, Range, vFanins, pName );
+                Vec_IntShrink( &p->vFanStack, iStart );
                 return iObj;
             }
         }
@@ -1263,8 +1305,13 @@ Wlc_Ntk_t * Smt_PrsBuild2( Smt_Prs_t * p )
     char * pName, * pRange;
     // start network and create primary inputs
     pNtk = Wlc_NtkAlloc( p->pName, 1000 );
-    pNtk->pManName = Abc_NamStart( 1000, 24 );
+    pNtk->pManName = Abc_NamStart( Abc_MaxInt(1000, Vec_WecSize(&p->vObjs)/2), 16 );
     pNtk->fSmtLib = 1;
+    // start structural hashing of the terms
+    assert( p->pHash == NULL );
+    p->pHash = Hsh_VecManStart( Abc_MaxInt(1000, Vec_WecSize(&p->vObjs)/2) );
+    Vec_IntFill( &p->vTokTypes, Abc_NamObjNumMax(p->pStrs), 0 );
+    Vec_IntFill( &p->vTokObjs, Abc_NamObjNumMax(p->pStrs), 0 );
     // collect top-level asserts
     vFansRoot = Vec_WecEntry( &p->vObjs, 0 );
     Vec_IntForEachEntry( vFansRoot, Root, i )
@@ -1360,7 +1407,7 @@ Wlc_Ntk_t * Smt_PrsBuild2( Smt_Prs_t * p )
                 else if ( !strcmp("true", pValue) )
                     pValue = "#b1";
                 else assert( 0 );
-                Status = Smt_PrsBuildConstant( pNtk, pValue, Range, pName );    
+                Status = Smt_PrsBuildConstant( pNtk, p, pValue, Range, pName );    
             }
             else
             {
@@ -1480,7 +1527,7 @@ Wlc_Ntk_t * Smt_PrsBuild2( Smt_Prs_t * p )
         iObj = Smt_PrsCreateNode( pNtk, WLC_OBJ_BUF, 0, 1, vAsserts, "miter" );
     // added: 0 asserts
     else if ( Vec_IntSize(vAsserts) == 0 )
-        iObj = Smt_PrsBuildConstant( pNtk, "#b1", 1, "miter" );
+        iObj = Smt_PrsBuildConstant( pNtk, p, "#b1", 1, "miter" );
     else
     {
         iObj = Smt_PrsCreateNode( pNtk, WLC_OBJ_BIT_CONCAT, 0, Vec_IntSize(vAsserts), vAsserts, NULL );
@@ -1603,7 +1650,7 @@ static inline Smt_Prs_t * Smt_PrsAlloc( char * pFileName, char * pBuffer, char *
     p->pBuffer = pBuffer;
     p->pLimit  = pLimit;
     p->pCur    = pBuffer;
-    p->pStrs   = Abc_NamStart( 1000, 24 );
+    p->pStrs   = Abc_NamStart( Abc_MaxInt(1000, nObjs/4), 24 );
     Smt_AddTypes( p->pStrs );
     Vec_IntGrow( &p->vStack, 100 );
     //Vec_WecGrow( &p->vDepth, 100 );
@@ -1614,10 +1661,20 @@ static inline void Smt_PrsFree( Smt_Prs_t * p )
 {
     if ( p->pStrs )
         Abc_NamDeref( p->pStrs );
+    if ( p->pHash )
+        Hsh_VecManStop( p->pHash );
     Vec_IntErase( &p->vStack );
     Vec_IntErase( &p->vTempFans );
+    Vec_IntErase( &p->vFanStack );
+    Vec_StrErase( &p->vName );
+    Vec_IntErase( &p->vTokTypes );
+    Vec_IntErase( &p->vTokObjs );
+    Vec_IntErase( &p->vHashKey );
+    Vec_IntErase( &p->vHashObjs );
     //Vec_WecErase( &p->vDepth );
-    Vec_WecErase( &p->vObjs );
+    // the entries of vObjs point into vArena
+    ABC_FREE( p->vObjs.pArray );
+    Vec_IntErase( &p->vArena );
     ABC_FREE( p );
 }
 
@@ -1648,7 +1705,9 @@ static inline void Smt_PrsSkipNonSpaces( Smt_Prs_t * p )
 }
 void Smt_PrsReadLines( Smt_Prs_t * p )
 {
-    int fFirstTime = 1;
+    Vec_Int_t * vPairs = Vec_IntAlloc( 2 * Vec_WecCap(&p->vObjs) );
+    Vec_Int_t * vStarts;
+    int i, iNode, nNodes = 0, fFirstTime = 1;
     assert( Vec_IntSize(&p->vStack) == 0 );
     //assert( Vec_WecSize(&p->vDepth) == 0 );
     assert( Vec_WecSize(&p->vObjs) == 0 );
@@ -1656,9 +1715,8 @@ void Smt_PrsReadLines( Smt_Prs_t * p )
     //Vec_WecPushLevel( &p->vDepth );
     //Vec_WecPush( &p->vDepth, Vec_IntSize(&p->vStack), Vec_WecSize(&p->vObjs) );
     // add top node
-    Vec_IntPush( &p->vStack, Vec_WecSize(&p->vObjs) );
-    Vec_WecPushLevel( &p->vObjs );
-    // add other nodes
+    Vec_IntPush( &p->vStack, nNodes++ );
+    // add other nodes while recording (parent, fanin) pairs
     for ( p->pCur = p->pBuffer; p->pCur < p->pLimit; p->pCur++ )
     {
         Smt_PrsSkipSpaces( p );
@@ -1680,10 +1738,9 @@ void Smt_PrsReadLines( Smt_Prs_t * p )
             //    Vec_WecPushLevel(&p->vDepth);
             //Vec_WecPush( &p->vDepth, Vec_IntSize(&p->vStack), Vec_WecSize(&p->vObjs) );
             // add fanin to node on the previous level
-            Vec_IntPush( Vec_WecEntry(&p->vObjs, Vec_IntEntryLast(&p->vStack)), Abc_Var2Lit(Vec_WecSize(&p->vObjs), 0) );            
+            Vec_IntPushTwo( vPairs, Vec_IntEntryLast(&p->vStack), Abc_Var2Lit(nNodes, 0) );
             // add node to the stack
-            Vec_IntPush( &p->vStack, Vec_WecSize(&p->vObjs) );
-            Vec_WecPushLevel( &p->vObjs );
+            Vec_IntPush( &p->vStack, nNodes++ );
         }
         else if ( *p->pCur == ')' )
         {
@@ -1706,12 +1763,34 @@ void Smt_PrsReadLines( Smt_Prs_t * p )
                         *pTemp = '_';*/
                 // create and save token for this string
                 iToken = Abc_NamStrFindOrAddLim( p->pStrs, pStart, p->pCur--, NULL );
-                Vec_IntPush( Vec_WecEntry(&p->vObjs, Vec_IntEntryLast(&p->vStack)), Abc_Var2Lit(iToken, 1) );
+                Vec_IntPushTwo( vPairs, Vec_IntEntryLast(&p->vStack), Abc_Var2Lit(iToken, 1) );
             }
         }
     }
     assert( Vec_IntSize(&p->vStack) == 1 );
-    assert( Vec_WecSize(&p->vObjs) == Vec_WecCap(&p->vObjs) );
+    assert( nNodes == Vec_WecCap(&p->vObjs) );
+    // place the fanins of each node next to each other in one array
+    vStarts = Vec_IntStart( nNodes + 1 );
+    for ( i = 0; i < Vec_IntSize(vPairs); i += 2 )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vPairs, i) + 1, 1 );
+    for ( i = 0; i < nNodes; i++ )
+        Vec_IntAddToEntry( vStarts, i + 1, Vec_IntEntry(vStarts, i) );
+    Vec_IntFill( &p->vArena, Vec_IntSize(vPairs) / 2, 0 );
+    Vec_WecInit( &p->vObjs, nNodes );
+    for ( i = 0; i < nNodes; i++ )
+    {
+        Vec_Int_t * vLevel = Vec_WecEntry( &p->vObjs, i );
+        vLevel->pArray = Vec_IntArray(&p->vArena) + Vec_IntEntry(vStarts, i);
+        vLevel->nCap   = Vec_IntEntry(vStarts, i + 1) - Vec_IntEntry(vStarts, i);
+        vLevel->nSize  = 0;
+    }
+    for ( i = 0; i < Vec_IntSize(vPairs); i += 2 )
+    {
+        iNode = Vec_IntEntry( vPairs, i );
+        Vec_WecEntry(&p->vObjs, iNode)->pArray[Vec_WecEntry(&p->vObjs, iNode)->nSize++] = Vec_IntEntry( vPairs, i + 1 );
+    }
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vPairs );
     p->nDigits = Abc_Base16Log( Vec_WecSize(&p->vObjs) );
 }
 void Smt_PrsPrintParser_rec( Smt_Prs_t * p, int iObj, int Depth )
@@ -42,6 +42,8 @@ static int Scl_CommandLeak2Area  ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandDumpGen    ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandPrintGS    ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandStime      ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Scl_CommandSession    ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Scl_CommandPower      ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandTopo       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandUnBuffer   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandBuffer     ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -52,6 +54,7 @@ static int Scl_CommandUpsize     ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandDnsize     ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandPrintBuf   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandReadConstr ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Scl_CommandReadPlace  ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandWriteConstr( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandPrintConstr( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Scl_CommandResetConstr( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -112,6 +115,8 @@ void Scl_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "SCL mapping",  "dump_genlib",   Scl_CommandDumpGen,     0 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "print_gs",      Scl_CommandPrintGS,     0 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "stime",         Scl_CommandStime,       0 ); 
+    Cmd_CommandAdd( pAbc, "SCL mapping",  "stime_session", Scl_CommandSession,     1 ); 
+    Cmd_CommandAdd( pAbc, "SCL mapping",  "spower",        Scl_CommandPower,       0 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "topo",          Scl_CommandTopo,        1 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "unbuffer",      Scl_CommandUnBuffer,    1 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "buffer",        Scl_CommandBuffer,      1 ); 
@@ -124,6 +129,7 @@ void Scl_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "SCL mapping",  "mlgen",         Scl_CommandMLDataset,   1 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "print_buf",     Scl_CommandPrintBuf,    0 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "read_constr",   Scl_CommandReadConstr,  0 ); 
+    Cmd_CommandAdd( pAbc, "SCL mapping",  "read_place",    Scl_CommandReadPlace,   0 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "write_constr",  Scl_CommandWriteConstr, 0 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "print_constr",  Scl_CommandPrintConstr, 0 ); 
     Cmd_CommandAdd( pAbc, "SCL mapping",  "reset_constr",  Scl_CommandResetConstr, 0 ); 
@@ -152,16 +158,17 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     char * pFileName;
     FILE * pFile;
     SC_Lib * pLib;
-    int c, fDump = 0;
+    int c, fDump = 0, fCorner = 0;
     float Slew = 0;
     float Gain = 0;
     int nGatesMin = 0;
     int fShortNames = 0;
     int fVerbose = 1;
     int fVeryVerbose = 0;
+    char * pCacheDir = NULL;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SGMdnvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SGMCadnvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -198,6 +205,18 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nGatesMin < 0 ) 
                 goto usage;
             break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by a directory name.\n" );
+                goto usage;
+            }
+            pCacheDir = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'a':
+            fCorner ^= 1;
+            break;
         case 'd':
             fDump ^= 1;
             break;
@@ -226,8 +245,13 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     fclose( pFile );
+    if ( fCorner && pAbc->pLibScl == NULL )
+    {
+        fprintf( pAbc->Err, "The current library is not available.\n" );
+        return 1;
+    }
     // read new library
-    pLib = Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose );
+    pLib = Abc_SclReadLiberty( pFileName, pCacheDir, fVerbose, fVeryVerbose );
     if ( pLib == NULL )
     {
         fprintf( pAbc->Err, "Reading SCL library from file \"%s\" has failed. \n", pFileName );
@@ -239,6 +263,19 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_SclLibFree(pLib);
         return 0;
     }
+    // add the library as a timing corner of the current library
+    if ( fCorner )
+    {
+        if ( !Abc_SclLibAddCorner( (SC_Lib *)pAbc->pLibScl, pLib ) )
+        {
+            Abc_SclLibFree( pLib );
+            return 1;
+        }
+        if ( fVerbose )
+            printf( "Library \"%s\" is added as timing corner %d of library \"%s\".\n", pLib->pName, 
+                Vec_PtrSize(&((SC_Lib *)pAbc->pLibScl)->vCorners), ((SC_Lib *)pAbc->pLibScl)->pName );
+        return 0;
+    }
     Abc_SclLoad( pLib, (SC_Lib **)&pAbc->pLibScl );
     // convert the library if needed
     if ( fShortNames )
@@ -255,11 +292,13 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-M num] [-dnvwh] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-M num] [-C dir] [-adnvwh] <file>\n" );
     fprintf( pAbc->Err, "\t           reads Liberty library from file\n" );
     fprintf( pAbc->Err, "\t-S float : the slew parameter used to generate the library [default = %.2f]\n", Slew );
     fprintf( pAbc->Err, "\t-G float : the gain parameter used to generate the library [default = %.2f]\n", Gain );
     fprintf( pAbc->Err, "\t-M num   : skip gate classes whose size is less than this [default = %d]\n", nGatesMin );
+    fprintf( pAbc->Err, "\t-C dir   : the directory to cache the compiled library keyed by the file hash [default = %s]\n", pCacheDir ? pCacheDir : "none" );
+    fprintf( pAbc->Err, "\t-a       : toggle adding the library as a timing corner of the current library [default = %s]\n", fCorner? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping the parsed library into file \"*_temp.lib\" [default = %s]\n", fDump? "yes": "no" );
     fprintf( pAbc->Err, "\t-n       : toggle replacing gate/pin names by short strings [default = %s]\n", fShortNames? "yes": "no" );
     fprintf( pAbc->Err, "\t-v       : toggle writing verbose information [default = %s]\n", fVerbose? "yes": "no" );
@@ -761,9 +800,10 @@ int Scl_CommandStime( Abc_Frame_t * pAbc, int argc, char **argv )
     int fPrintPath    = 0;
     int fDumpStats    = 0;
     int nTreeCRatio   = 0;
+    int nThreads      = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Xcapdh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "XPcapdh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -778,6 +818,17 @@ int Scl_CommandStime( Abc_Frame_t * pAbc, int argc, char **argv )
                 if ( nTreeCRatio < 0 ) 
                     goto usage;
                 break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads < 0 ) 
+                    goto usage;
+                break;
             case 'c':
                 fUseWireLoads ^= 1;
                 break;
@@ -818,13 +869,14 @@ int Scl_CommandStime( Abc_Frame_t * pAbc, int argc, char **argv )
         return 1;
     }
 
-    Abc_SclTimePerform( (SC_Lib *)pAbc->pLibScl, Abc_FrameReadNtk(pAbc), nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerform( (SC_Lib *)pAbc->pLibScl, Abc_FrameReadNtk(pAbc), nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nThreads );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: stime [-X num] [-capdth]\n" );
+    fprintf( pAbc->Err, "usage: stime [-XP num] [-capdth]\n" );
     fprintf( pAbc->Err, "\t         performs STA using Liberty library\n" );
     fprintf( pAbc->Err, "\t-X     : min Cout/Cave ratio for tree estimations [default = %d]\n", nTreeCRatio );
+    fprintf( pAbc->Err, "\t-P     : the number of threads for level-parallel timing [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-c     : toggle using wire-loads if specified [default = %s]\n", fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-a     : display timing information for all nodes [default = %s]\n", fShowAll? "yes": "no" );
     fprintf( pAbc->Err, "\t-p     : display timing information for critical path [default = %s]\n", fPrintPath? "yes": "no" );
@@ -833,6 +885,231 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Scl_CommandSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    FILE * pFile = stdin;
+    int c;
+    int fUseWireLoads = 0;
+    int nTreeCRatio   = 0;
+    int fVerbose      = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Xcvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'X':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-X\" should be followed by a positive integer.\n" );
+                    goto usage;
+                }
+                nTreeCRatio = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nTreeCRatio < 0 ) 
+                    goto usage;
+                break;
+            case 'c':
+                fUseWireLoads ^= 1;
+                break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc > globalUtilOptind + 1 )
+        goto usage;
+
+    if ( Abc_FrameReadNtk(pAbc) == NULL )
+    {
+        fprintf( pAbc->Err, "There is no current network.\n" );
+        return 1;
+    }
+    if ( !Abc_NtkHasMapping(Abc_FrameReadNtk(pAbc)) )
+    {
+        fprintf( pAbc->Err, "The current network is not mapped.\n" );
+        return 1;
+    }
+    if ( !Abc_SclCheckNtk(Abc_FrameReadNtk(pAbc), 0) )
+    {
+        fprintf( pAbc->Err, "The current network is not in a topo order (run \"topo\").\n" );
+        return 1;
+    }
+    if ( pAbc->pLibScl == NULL )
+    {
+        fprintf( pAbc->Err, "There is no Liberty library available.\n" );
+        return 1;
+    }
+    if ( argc == globalUtilOptind + 1 && (pFile = fopen( argv[globalUtilOptind], "rb" )) == NULL )
+    {
+        fprintf( pAbc->Err, "Cannot open input file \"%s\".\n", argv[globalUtilOptind] );
+        return 1;
+    }
+
+    Abc_SclSessionPerform( (SC_Lib *)pAbc->pLibScl, Abc_FrameReadNtk(pAbc), pFile, stdout, pAbc->Err, nTreeCRatio, fUseWireLoads, fVerbose );
+    if ( pFile != stdin )
+        fclose( pFile );
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: stime_session [-X num] [-cvh] <file>\n" );
+    fprintf( pAbc->Err, "\t         runs incremental timing session driven by commands\n" );
+    fprintf( pAbc->Err, "\t         (size <obj> <cell>, move <obj> <x> <y>, cell <obj>, arrival <obj>, slack <obj>,\n" );
+    fprintf( pAbc->Err, "\t         delay, commit, undo, quit) answering each one line on stdout\n" );
+    fprintf( pAbc->Err, "\t-X     : min Cout/Cave ratio for tree estimations [default = %d]\n", nTreeCRatio );
+    fprintf( pAbc->Err, "\t-c     : toggle using wire-loads if specified [default = %s]\n", fUseWireLoads? "yes": "no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
+    fprintf( pAbc->Err, "\t<file> : the file with commands [default = stdin]\n" );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Scl_CommandPower( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    char * pFileName  = NULL;
+    float Freq        = 0;
+    int c;
+    int nPats         = 4096;
+    int nThreads      = 1;
+    int nTreeCRatio   = 0;
+    int fUseWireLoads = 0;
+    int fShowAll      = 0;
+    int fVerbose      = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NPFXcavh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'N':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-N\" should be followed by a positive integer.\n" );
+                    goto usage;
+                }
+                nPats = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nPats < 2 ) 
+                    goto usage;
+                break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads <= 0 ) 
+                    goto usage;
+                break;
+            case 'F':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-F\" should be followed by a floating point number.\n" );
+                    goto usage;
+                }
+                Freq = atof(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( Freq < 0 ) 
+                    goto usage;
+                break;
+            case 'X':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-X\" should be followed by a positive integer.\n" );
+                    goto usage;
+                }
+                nTreeCRatio = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nTreeCRatio < 0 ) 
+                    goto usage;
+                break;
+            case 'c':
+                fUseWireLoads ^= 1;
+                break;
+            case 'a':
+                fShowAll ^= 1;
+                break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+
+    if ( Abc_FrameReadNtk(pAbc) == NULL )
+    {
+        fprintf( pAbc->Err, "There is no current network.\n" );
+        return 1;
+    }
+    if ( !Abc_NtkHasMapping(Abc_FrameReadNtk(pAbc)) )
+    {
+        fprintf( pAbc->Err, "The current network is not mapped.\n" );
+        return 1;
+    }
+    if ( !Abc_SclCheckNtk(Abc_FrameReadNtk(pAbc), 0) )
+    {
+        fprintf( pAbc->Err, "The current network is not in a topo order (run \"topo\").\n" );
+        return 1;
+    }
+    if ( pAbc->pLibScl == NULL )
+    {
+        fprintf( pAbc->Err, "There is no Liberty library available.\n" );
+        return 1;
+    }
+    if ( argc == globalUtilOptind + 1 )
+        pFileName = argv[globalUtilOptind];
+    else if ( argc != globalUtilOptind )
+        goto usage;
+
+    Abc_SclPowerPerform( (SC_Lib *)pAbc->pLibScl, Abc_FrameReadNtk(pAbc), pFileName, nPats, Freq, nThreads, nTreeCRatio, fUseWireLoads, fShowAll, fVerbose );
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: spower [-NPX num] [-F float] [-cavh] <file>\n" );
+    fprintf( pAbc->Err, "\t         estimates power using simulation of the network and Liberty library\n" );
+    fprintf( pAbc->Err, "\t-N     : the number of random patterns (clock cycles) [default = %d]\n", nPats );
+    fprintf( pAbc->Err, "\t-P     : the number of simulation threads [default = %d]\n", nThreads );
+    fprintf( pAbc->Err, "\t-X     : min Cout/Cave ratio for tree estimations [default = %d]\n", nTreeCRatio );
+    fprintf( pAbc->Err, "\t-F     : clock frequency in MHz (0 = derive from the delay) [default = %.2f]\n", Freq );
+    fprintf( pAbc->Err, "\t-c     : toggle using wire-loads if specified [default = %s]\n", fUseWireLoads? "yes": "no" );
+    fprintf( pAbc->Err, "\t-a     : display power information for all nodes [default = %s]\n", fShowAll? "yes": "no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
+    fprintf( pAbc->Err, "\t<file> : the file with simulation vectors, one pattern per line [default = random]\n" );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -982,10 +1259,11 @@ int Scl_CommandBuffer( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->fAddBufs      =    1;
     pPars->fBufPis       =    0;
     pPars->fUseWireLoads =    0;
+    pPars->fTimingTree   =    0;
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "GSNsbpcvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "GSNsbpctvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1034,6 +1312,9 @@ int Scl_CommandBuffer( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'c':
             pPars->fUseWireLoads ^= 1;
             break;
+        case 't':
+            pPars->fTimingTree ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -1067,8 +1348,16 @@ int Scl_CommandBuffer( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Library delay info is not available.\n" );
         return 1;
     }
+    if ( pPars->fTimingTree && !pPars->fAddBufs )
+    {
+        Abc_Print( -1, "Timing-driven buffer trees are built using buffers only.\n" );
+        return 1;
+    }
     // modify the current network
-    pNtkRes = Abc_SclBufferingPerform( pNtk, (SC_Lib *)pAbc->pLibScl, pPars );
+    if ( pPars->fTimingTree )
+        pNtkRes = Abc_SclBufTreePerform( pNtk, (SC_Lib *)pAbc->pLibScl, pPars );
+    else
+        pNtkRes = Abc_SclBufferingPerform( pNtk, (SC_Lib *)pAbc->pLibScl, pPars );
     if ( pNtkRes == NULL )
     {
         Abc_Print( -1, "The command has failed.\n" );
@@ -1079,7 +1368,7 @@ int Scl_CommandBuffer( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: buffer [-GSN num] [-sbpcvwh]\n" );
+    fprintf( pAbc->Err, "usage: buffer [-GSN num] [-sbpctvwh]\n" );
     fprintf( pAbc->Err, "\t           performs buffering and sizing and mapped network\n" );
     fprintf( pAbc->Err, "\t-G <num> : target gain percentage [default = %d]\n", pPars->GainRatio );
     fprintf( pAbc->Err, "\t-S <num> : target slew in pisoseconds [default = %d]\n", pPars->Slew );
@@ -1088,6 +1377,7 @@ usage:
     fprintf( pAbc->Err, "\t-b       : toggle using buffers instead of inverters [default = %s]\n", pPars->fAddBufs? "yes": "no" );
     fprintf( pAbc->Err, "\t-p       : toggle buffering primary inputs [default = %s]\n", pPars->fBufPis? "yes": "no" );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
+    fprintf( pAbc->Err, "\t-t       : toggle building fanout trees using incremental timing [default = %s]\n", pPars->fTimingTree? "yes": "no" );
     fprintf( pAbc->Err, "\t-v       : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     fprintf( pAbc->Err, "\t-w       : toggle printing more verbose information [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     fprintf( pAbc->Err, "\t-h       : print the command usage\n");
@@ -1554,7 +1844,7 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->fVeryVerbose  =    0;
     int fUseMLSizer          =    0; //MLSizer option
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXBLcsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXBPLcsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1666,6 +1956,17 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
             if ( pPars->BypassFreq < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 ) 
+                goto usage;
+            break;
         case 'L':
             fUseMLSizer ^= 1;
             Abc_Print( -1, "Command line switch \"-L\" has been deleted.\n" );
@@ -1718,7 +2019,7 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXB num] [-csdvwh]\n" );
+    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXBP num] [-csdvwh]\n" );
     fprintf( pAbc->Err, "\t           selectively increases gate sizes on the critical path\n" );
     fprintf( pAbc->Err, "\t-I <num> : the number of upsizing iterations to perform [default = %d]\n", pPars->nIters );
     fprintf( pAbc->Err, "\t-J <num> : the number of iterations without improvement to stop [default = %d]\n", pPars->nIterNoChange );
@@ -1730,6 +2031,7 @@ usage:
     fprintf( pAbc->Err, "\t-T <num> : approximate timeout in seconds [default = %d]\n", pPars->TimeOut );
     fprintf( pAbc->Err, "\t-X <num> : ratio for buffer tree estimation [default = %d]\n", pPars->BuffTreeEst );
     fprintf( pAbc->Err, "\t-B <num> : frequency of bypass transforms [default = %d]\n", pPars->BypassFreq );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads for timing and candidate evaluation [default = %d]\n", pPars->nThreads );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-s       : toggle using slack based on departure times [default = %s]\n", pPars->fUseDept? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping statistics into a file [default = %s]\n", pPars->fDumpStats? "yes": "no" );
@@ -1763,13 +2065,14 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->DelayGap      = 1000;
     pPars->TimeOut       =    0;
     pPars->BuffTreeEst   =    0;
+    pPars->nThreads      =    0;
     pPars->fUseDept      =    1;
     pPars->fUseWireLoads =    0;
     pPars->fDumpStats    =    0;
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "IJNDGTXcsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "IJNDGTXPcsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1848,6 +2151,17 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
             if ( pPars->BuffTreeEst < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 ) 
+                goto usage;
+            break;
         case 'c':
             pPars->fUseWireLoads ^= 1;
             break;
@@ -1895,7 +2209,7 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: dnsize [-IJNDGTX num] [-csdvwh]\n" );
+    fprintf( pAbc->Err, "usage: dnsize [-IJNDGTXP num] [-csdvwh]\n" );
     fprintf( pAbc->Err, "\t           selectively decreases gate sizes while maintaining delay\n" );
     fprintf( pAbc->Err, "\t-I <num> : the number of upsizing iterations to perform [default = %d]\n", pPars->nIters );
     fprintf( pAbc->Err, "\t-J <num> : the number of iterations without improvement to stop [default = %d]\n", pPars->nIterNoChange );
@@ -1904,6 +2218,7 @@ usage:
     fprintf( pAbc->Err, "\t-G <num> : delay gap during updating, in picoseconds [default = %d]\n", pPars->DelayGap );
     fprintf( pAbc->Err, "\t-T <num> : approximate timeout in seconds [default = %d]\n", pPars->TimeOut );
     fprintf( pAbc->Err, "\t-X <num> : ratio for buffer tree estimation [default = %d]\n", pPars->BuffTreeEst );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads for batch evaluation of non-interacting nodes [default = %d]\n", pPars->nThreads );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-s       : toggle using slack based on departure times [default = %s]\n", pPars->fUseDept? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping statistics into a file [default = %s]\n", pPars->fDumpStats? "yes": "no" );
@@ -2053,6 +2368,88 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Scl_CommandReadPlace( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
+    SC_Lib * pLib = (SC_Lib *)pAbc->pLibScl;
+    float PlaceCap = -1;
+    int c, fRemove = 0, fVerbose = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Crvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by a floating point number.\n" );
+                goto usage;
+            }
+            PlaceCap = (float)atof(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( PlaceCap < 0 )
+                goto usage;
+            break;
+        case 'r':
+            fRemove ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pNtk == NULL )
+    {
+        fprintf( pAbc->Err, "There is no current network.\n" );
+        return 1;
+    }
+    if ( !Abc_NtkHasMapping(pNtk) )
+    {
+        fprintf( pAbc->Err, "The current network is not mapped.\n" );
+        return 1;
+    }
+    if ( fRemove )
+    {
+        Vec_FltFreeP( &pNtk->vPlace );
+        return 0;
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    if ( PlaceCap < 0 )
+        PlaceCap = (pLib && Vec_PtrSize(&pLib->vWireLoads)) ? ((SC_WireLoad *)Vec_PtrEntry(&pLib->vWireLoads, 0))->cap : 1.0;
+    if ( !Abc_SclReadPlacement( pNtk, argv[globalUtilOptind], PlaceCap, fVerbose ) )
+        return 1;
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: read_place [-C float] [-rvh] <file>\n" );
+    fprintf( pAbc->Err, "\t           reads placement of the mapped network in Bookshelf format (.pl);\n" );
+    fprintf( pAbc->Err, "\t           when placement is available, SCL timing computes wire loads\n" );
+    fprintf( pAbc->Err, "\t           from the Steiner-corrected half-perimeter of each net\n" );
+    fprintf( pAbc->Err, "\t-C float : wire capacitance per unit of distance [default = %s]\n", "first wire-load model or 1.0" );
+    fprintf( pAbc->Err, "\t-r       : toggle removing placement from the current network [default = %s]\n", fRemove? "yes": "no" );
+    fprintf( pAbc->Err, "\t-v       : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h       : prints the command summary\n" );
+    fprintf( pAbc->Err, "\t<file>   : the name of a file to read\n" );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -0,0 +1,455 @@
+/**CFile****************************************************************
+
+  FileName    [sclBufTree.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Timing-driven fanout-tree synthesis with sizing.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: sclBufTree.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+#include "map/mio/mio.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Scl_BtMan_t_ Scl_BtMan_t;
+struct Scl_BtMan_t_
+{
+    SC_BusPars *   pPars;      // parameters
+    SC_Man *       p;          // timing manager
+    SC_Cell *      pBuf;       // buffer representative
+    float          Gain;       // target gain (load over input cap)
+    float          LoadTarget; // the largest load of one buffer
+    int            LevelMax;   // upper bound on the logic level
+    // fanout tree of the current net
+    Vec_Wrd_t *    vKeys;      // sinks sorted by criticality (time, ID)
+    Vec_Wrd_t *    vNext;      // sinks of the next tree level
+    Vec_Flt_t *    vCins;      // input cap of each sink
+    Vec_Flt_t *    vTimes;     // departure time of each sink
+    // statistics
+    int            nNets;      // buffered nets
+    int            nBufs;      // added buffers
+    int            DepthMax;   // the largest tree depth
+};
+
+static inline word        Scl_BtKey( float Time, int Id )                   { return ((word)(unsigned)Abc_Float2Int(Abc_MaxFloat(Time, 0)) << 32) | (word)(unsigned)Id; }
+static inline int         Scl_BtKeyId( word Key )                           { return (int)(Key & 0xFFFFFFFF);                   }
+static inline float       Scl_BtObjCin( Scl_BtMan_t * p, int Id )           { return Vec_FltEntry( p->vCins, Id );              }
+static inline float       Scl_BtObjTime( Scl_BtMan_t * p, int Id )          { return Vec_FltEntry( p->vTimes, Id );             }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Keeps the timing data in sync with the network size.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Scl_BtManGrow( Scl_BtMan_t * p )
+{
+    int nObjs = Abc_NtkObjNumMax( p->p->pNtk );
+    Abc_SclManGrow( p->p, nObjs );
+    Vec_FltFillExtra( p->vCins,  nObjs, 0 );
+    Vec_FltFillExtra( p->vTimes, nObjs, 0 );
+    while ( Vec_WecSize(p->p->vLevels) <= p->LevelMax )
+        Vec_WecPushLevel( p->p->vLevels );
+}
+Scl_BtMan_t * Scl_BtManStart( SC_Man * pScl, SC_BusPars * pPars )
+{
+    Scl_BtMan_t * p;
+    float Gain = 0.01 * pPars->GainRatio;
+    p = ABC_CALLOC( Scl_BtMan_t, 1 );
+    p->pPars      = pPars;
+    p->p          = pScl;
+    p->pBuf       = Abc_SclFindInvertor( pScl->pLib, 1 );
+    p->Gain       = Gain * Gain; // each buffer is two inverters
+    p->LoadTarget = p->Gain * SC_CellPinCapAve( p->pBuf->pPrev );
+    p->LevelMax   = Vec_WecSize( pScl->vLevels );
+    p->vKeys      = Vec_WrdAlloc( 1000 );
+    p->vNext      = Vec_WrdAlloc( 1000 );
+    p->vCins      = Vec_FltAlloc( 2 * pScl->nObjs );
+    p->vTimes     = Vec_FltAlloc( 2 * pScl->nObjs );
+    Scl_BtManGrow( p );
+    return p;
+}
+void Scl_BtManStop( Scl_BtMan_t * p )
+{
+    Vec_WrdFree( p->vKeys );
+    Vec_WrdFree( p->vNext );
+    Vec_FltFree( p->vCins );
+    Vec_FltFree( p->vTimes );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes the load of the node from its fanouts.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclBufTreeComputeLoad( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
+    Abc_Obj_t * pFanout;
+    int i;
+    pLoad->rise = pLoad->fall = 0;
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( Abc_ObjIsCo(pFanout) )
+            SC_PairAdd( pLoad, Abc_SclObjLoad(p, pFanout) );
+        else
+        {
+            SC_Pin * pPin = SC_CellPin( Abc_SclObjCell(pFanout), Abc_NodeFindFanin(pFanout, pObj) );
+            pLoad->rise += pPin->rise_cap;
+            pLoad->fall += pPin->fall_cap;
+        }
+    }
+    // the wire load comes from the placement when it is available (see Abc_SclComputeLoad)
+    if ( p->vPlace != NULL )
+        Abc_SclAddPlaceLoad( p, pObj, 0 );
+    else if ( p->pWLoadUsed != NULL )
+        Abc_SclAddWireLoad( p, pObj, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the sinks of the net sorted by criticality.]
+
+  Description [The criticality of a sink is the departure time of the
+  fanout plus the delay of its pin under the target slew. Returns 0 if
+  the net cannot be restructured (duplicated or sequential fanouts).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclBufTreeCollectSinks( Scl_BtMan_t * p, Abc_Obj_t * pObj )
+{
+    SC_Man * pScl = p->p;
+    Abc_Obj_t * pFanout;
+    float Time, Cin;
+    int i, iFanin, RetValue = 1;
+    Vec_WrdClear( p->vKeys );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( pFanout->fMarkA || Abc_ObjIsLatch(pFanout) )
+        {
+            RetValue = 0;
+            break;
+        }
+        pFanout->fMarkA = 1;
+        Time = Abc_MaxFloat( Abc_SclObjDept(pScl, pFanout)->rise, Abc_SclObjDept(pScl, pFanout)->fall );
+        if ( Abc_ObjIsCo(pFanout) )
+            Cin = Abc_SclObjLoadAve( pScl, pFanout );
+        else
+        {
+            iFanin = Abc_NodeFindFanin( pFanout, pObj );
+            Cin  = SC_CellPinCap( Abc_SclObjCell(pFanout), iFanin );
+            Time += Scl_LibPinArrivalEstimate( Abc_SclObjCell(pFanout), iFanin, p->pPars->Slew, Abc_SclObjLoadAve(pScl, pFanout) );
+        }
+        Vec_FltWriteEntry( p->vCins,  Abc_ObjId(pFanout), Cin );
+        Vec_FltWriteEntry( p->vTimes, Abc_ObjId(pFanout), Time );
+        Vec_WrdPush( p->vKeys, Scl_BtKey(Time, Abc_ObjId(pFanout)) );
+    }
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+        pFanout->fMarkA = 0;
+    Vec_WrdSort( p->vKeys, 1 );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates one buffer driving the given sinks.]
+
+  Description [Sinks are either the original fanouts of the driver, which
+  are redirected without updating the fanout list of the driver, or the
+  buffers created at the previous tree level, which do not have fanins yet.
+  The fanout list of the driver is rebuilt when the tree is complete.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Obj_t * Abc_SclBufTreeAddBuffer( Scl_BtMan_t * p, Abc_Obj_t * pDriver, int iFirstBuf, word * pKeys, int nKeys, float Load )
+{
+    SC_Man * pScl = p->p;
+    Abc_Obj_t * pBuf, * pSink;
+    SC_Cell * pCell;
+    float Time = 0;
+    int i;
+    pBuf = Abc_NtkCreateNodeBuf( pScl->pNtk, NULL );
+    Scl_BtManGrow( p );
+    for ( i = 0; i < nKeys; i++ )
+    {
+        pSink = Abc_NtkObj( pScl->pNtk, Scl_BtKeyId(pKeys[i]) );
+        Time  = Abc_MaxFloat( Time, Scl_BtObjTime(p, Abc_ObjId(pSink)) );
+        if ( (int)Abc_ObjId(pSink) >= iFirstBuf )
+            Abc_ObjAddFanin( pSink, pBuf );
+        else
+        {
+            Vec_IntWriteEntry( &pSink->vFanins, Abc_NodeFindFanin(pSink, pDriver), Abc_ObjId(pBuf) );
+            Vec_IntPush( &pBuf->vFanouts, Abc_ObjId(pSink) );
+        }
+    }
+    pCell = Abc_SclFindSmallestGate( p->pBuf, Load / p->Gain );
+    Vec_IntSetEntry( pScl->pNtk->vGates, Abc_ObjId(pBuf), pCell->Id );
+    pScl->SumArea += pCell->area;
+    Time += Scl_LibPinArrivalEstimate( pCell, 0, p->pPars->Slew, Load );
+    Vec_FltWriteEntry( p->vCins,  Abc_ObjId(pBuf), SC_CellPinCap(pCell, 0) );
+    Vec_FltWriteEntry( p->vTimes, Abc_ObjId(pBuf), Time );
+    p->nBufs++;
+    return pBuf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the fanout tree of one net.]
+
+  Description [The tree is built level by level starting from the sinks.
+  At each level, the least critical sinks are grouped into clusters of
+  consecutive criticality, each bounded by the fanout limit and the load
+  of the largest buffer, until the remaining sinks and the new buffers
+  can be driven by the driver. The most critical sinks stay connected
+  to the driver. Each level takes linear time after sorting, while the
+  number of sinks decreases geometrically.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclBufTreeNet( Scl_BtMan_t * p, Abc_Obj_t * pObj, float LoadMax )
+{
+    SC_Man * pScl = p->p;
+    Abc_Obj_t * pBuf, * pSink;
+    word * pKeys;
+    float LoadRest, LoadBufs, LoadCur, Cin;
+    int nDegree = Abc_MaxInt( p->pPars->nDegree, 2 );
+    int iFirstBuf = Abc_NtkObjNumMax( pScl->pNtk );
+    int i, k, nKeys, iStop, nBufs, Depth = 0;
+    if ( !Abc_SclBufTreeCollectSinks(p, pObj) )
+        return 0;
+    while ( 1 )
+    {
+        pKeys = Vec_WrdArray( p->vKeys );
+        nKeys = Vec_WrdSize( p->vKeys );
+        LoadRest = 0;
+        for ( i = 0; i < nKeys; i++ )
+            LoadRest += Scl_BtObjCin( p, Scl_BtKeyId(pKeys[i]) );
+        if ( nKeys <= 1 || (nKeys <= nDegree && LoadRest + Abc_SclFindWireLoad(pScl->vWireCaps, nKeys) <= LoadMax) )
+            break;
+        // cluster the least critical sinks
+        Vec_WrdClear( p->vNext );
+        LoadBufs = 0;
+        nBufs = 0;
+        for ( iStop = nKeys; iStop > 0; iStop = k )
+        {
+            if ( iStop + nBufs <= nDegree && LoadRest + LoadBufs + Abc_SclFindWireLoad(pScl->vWireCaps, iStop + nBufs) <= LoadMax )
+                break;
+            LoadCur = 0;
+            for ( k = iStop; k > 0 && iStop - k < nDegree; k-- )
+            {
+                Cin = Scl_BtObjCin( p, Scl_BtKeyId(pKeys[k-1]) );
+                if ( iStop - k >= 2 && LoadCur + Cin + Abc_SclFindWireLoad(pScl->vWireCaps, iStop - k + 1) > p->LoadTarget )
+                    break;
+                LoadCur += Cin;
+            }
+            LoadRest -= LoadCur;
+            LoadCur  += Abc_SclFindWireLoad( pScl->vWireCaps, iStop - k );
+            pBuf = Abc_SclBufTreeAddBuffer( p, pObj, iFirstBuf, pKeys + k, iStop - k, LoadCur );
+            LoadBufs += Scl_BtObjCin( p, Abc_ObjId(pBuf) );
+            Vec_WrdPush( p->vNext, Scl_BtKey(Scl_BtObjTime(p, Abc_ObjId(pBuf)), Abc_ObjId(pBuf)) );
+            nBufs++;
+        }
+        // the remaining sinks and the new buffers form the next level
+        for ( i = 0; i < iStop; i++ )
+            Vec_WrdPush( p->vNext, pKeys[i] );
+        Vec_WrdSort( p->vNext, 1 );
+        ABC_SWAP( Vec_Wrd_t *, p->vKeys, p->vNext );
+        Depth++;
+    }
+    if ( Depth == 0 )
+        return 0;
+    // connect the top level to the driver
+    Vec_IntClear( &pObj->vFanouts );
+    pKeys = Vec_WrdArray( p->vKeys );
+    nKeys = Vec_WrdSize( p->vKeys );
+    for ( i = 0; i < nKeys; i++ )
+    {
+        pSink = Abc_NtkObj( pScl->pNtk, Scl_BtKeyId(pKeys[i]) );
+        if ( (int)Abc_ObjId(pSink) >= iFirstBuf )
+            Abc_ObjAddFanin( pSink, pObj );
+        else
+            Vec_IntPush( &pObj->vFanouts, Abc_ObjId(pSink) );
+    }
+    // update levels, loads, and the timing queue
+    p->LevelMax += Depth;
+    Scl_BtManGrow( p );
+    for ( i = Abc_NtkObjNumMax(pScl->pNtk) - 1; i >= iFirstBuf; i-- )
+    {
+        pBuf = Abc_NtkObj( pScl->pNtk, i );
+        pBuf->Level = Abc_ObjLevelNew( pBuf );
+        Abc_SclBufTreeComputeLoad( pScl, pBuf );
+        Abc_SclTimeIncInsert( pScl, pBuf );
+        Abc_ObjForEachFanout( pBuf, pSink, k )
+            if ( (int)Abc_ObjId(pSink) < iFirstBuf )
+                Abc_SclTimeIncUpdateLevel( pSink );
+    }
+    Abc_SclBufTreeComputeLoad( pScl, pObj );
+    p->DepthMax = Abc_MaxInt( p->DepthMax, Depth );
+    p->nNets++;
+    return Depth;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs timing-driven buffering and sizing.]
+
+  Description [Nets are visited in the order of decreasing logic level,
+  so that the departure times of the sinks reflect the buffering and sizing
+  already performed in their transitive fanout. After each level, timing
+  is updated incrementally.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclBufTreeSize( Scl_BtMan_t * p )
+{
+    SC_Man * pScl = p->p;
+    Abc_Ntk_t * pNtk = pScl->pNtk;
+    SC_Cell * pCell, * pCellNew;
+    Vec_Wec_t * vByLevel;
+    Vec_Int_t * vLevel;
+    Abc_Obj_t * pObj;
+    float Load, LoadMax;
+    int i, k;
+    // collect the drivers by level
+    vByLevel = Vec_WecStart( Vec_WecSize(pScl->vLevels) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        if ( Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0 )
+            Vec_WecPush( vByLevel, Abc_ObjLevel(pObj), i );
+        else if ( Abc_ObjIsCi(pObj) && (p->pPars->fBufPis || pScl->pPiDrive) )
+            Vec_WecPush( vByLevel, 0, i );
+    }
+    Vec_WecForEachLevelReverse( vByLevel, vLevel, i )
+    {
+        Abc_NtkForEachObjVec( vLevel, pNtk, pObj, k )
+        {
+            if ( Abc_ObjIsCi(pObj) )
+            {
+                pCell   = NULL;
+                LoadMax = pScl->pPiDrive ? p->Gain * SC_CellPinCapAve(pScl->pPiDrive) : ABC_INFINITY;
+            }
+            else
+            {
+                pCell   = Abc_SclObjCell( pObj );
+                LoadMax = p->Gain * SC_CellPinCapAve( pCell->pAve );
+            }
+            // build the fanout tree
+            Load = Abc_SclObjLoadAve( pScl, pObj );
+            if ( !p->pPars->fSizeOnly && (Abc_ObjFanoutNum(pObj) > p->pPars->nDegree || Load > LoadMax) )
+            {
+                int nFanouts = Abc_ObjFanoutNum( pObj );
+                int Depth = Abc_SclBufTreeNet( p, pObj, LoadMax );
+                if ( Depth )
+                    Abc_SclTimeIncInsert( pScl, pObj );
+                if ( p->pPars->fVeryVerbose )
+                    printf( "Node %7d : Fanout = %6d -> %3d.  Depth = %2d.  Load = %9.2f ff -> %9.2f ff.\n",
+                        Abc_ObjId(pObj), nFanouts, Abc_ObjFanoutNum(pObj), Depth, Load, Abc_SclObjLoadAve(pScl, pObj) );
+            }
+            if ( pCell == NULL )
+                continue;
+            // size the driver
+            pCellNew = Abc_SclFindSmallestGate( pCell, Abc_SclObjLoadAve(pScl, pObj) / p->Gain );
+            if ( pCellNew == pCell )
+                continue;
+            Abc_SclObjSetCell( pObj, pCellNew );
+            Abc_SclUpdateLoad( pScl, pObj, pCell, pCellNew );
+            pScl->SumArea += pCellNew->area - pCell->area;
+            Abc_SclTimeIncInsert( pScl, pObj );
+        }
+        Abc_SclTimeIncUpdate( pScl );
+    }
+    Vec_WecFree( vByLevel );
+}
+Abc_Ntk_t * Abc_SclBufTreePerform( Abc_Ntk_t * pNtk, SC_Lib * pLib, SC_BusPars * pPars )
+{
+    Abc_Ntk_t * pNtkNew;
+    Scl_BtMan_t * p;
+    SC_Man * pScl;
+    abctime clk = Abc_Clock();
+    if ( !Abc_SclCheckNtk( pNtk, 0 ) )
+        return NULL;
+    if ( pNtk->nBarBufs2 > 0 )
+    {
+        printf( "Timing-driven buffer trees cannot be built for networks with barrier buffers.\n" );
+        return NULL;
+    }
+    if ( Abc_SclFindInvertor(pLib, 1) == NULL )
+    {
+        printf( "The library does not contain a buffer.\n" );
+        return NULL;
+    }
+    Abc_SclReportDupFanins( pNtk );
+    Abc_NtkLevel( pNtk );
+    pScl = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, 1, 0, 0, 0 );
+    p = Scl_BtManStart( pScl, pPars );
+    Abc_SclBufTreeSize( p );
+    pScl->MaxDelay = Abc_SclReadMaxDelay( pScl );
+    if ( pPars->fVerbose )
+    {
+        printf( "Degree = %d  Gain =%5d  Nets = %6d  Buf = %6d  Depth = %2d  ",
+            pPars->nDegree, pPars->GainRatio, p->nNets, p->nBufs, p->DepthMax );
+        printf( "Area =%10.2f (%+5.1f %%)  ", pScl->SumArea, 100.0 * (pScl->SumArea - pScl->SumArea0) / pScl->SumArea0 );
+        printf( "Delay =%8.2f ps (%+5.1f %%)  ", pScl->MaxDelay, 100.0 * (pScl->MaxDelay - pScl->MaxDelay0) / pScl->MaxDelay0 );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Scl_BtManStop( p );
+    Abc_SclSclGates2MioGates( pLib, pNtk );
+    Abc_SclManFree( pScl );
+    if ( pNtk->vPhases )
+        Vec_IntFillExtra( pNtk->vPhases, Abc_NtkObjNumMax(pNtk), 0 );
+    pNtkNew = Abc_NtkDupDfs( pNtk );
+    return pNtkNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
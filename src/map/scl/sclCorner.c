@@ -0,0 +1,263 @@
+/**CFile****************************************************************
+
+  FileName    [sclCorner.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Multi-corner static timing analysis.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: sclCorner.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static inline SC_Lib * Abc_SclManCorner( SC_Man * p, int c )  { return c ? (SC_Lib *)Vec_PtrEntry(&p->pLib->vCorners, c-1) : p->pLib; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the manager for multi-corner timing.]
+
+  Description [Corner 0 is the current library; the other corners are
+  the libraries attached to it by "read_lib -a". The cells of each corner
+  are matched with the cells of the current library by name. The loads
+  are computed using the current library only. The timing data of each
+  object is stored for all corners in consecutive entries.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclManStartCorners( SC_Man * p )
+{
+    SC_Lib * pLibC;
+    SC_Cell * pCell;
+    int i, c, iCell;
+    if ( Vec_PtrSize(&p->pLib->vCorners) == 0 )
+        return;
+    p->nCorners     = 1 + Vec_PtrSize(&p->pLib->vCorners);
+    p->pCornerCells = ABC_CALLOC( SC_Cell *, SC_LibCellNum(p->pLib) * p->nCorners );
+    p->pCornerDrive = ABC_CALLOC( SC_Cell *, p->nCorners );
+    p->pCornerTimes = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+    p->pCornerSlews = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+    p->pCornerDepts = ABC_CALLOC( SC_Pair, p->nObjs * p->nCorners );
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        pLibC = Abc_SclManCorner( p, c );
+        SC_LibForEachCell( p->pLib, pCell, i )
+        {
+            iCell = c ? Abc_SclCellFind( pLibC, pCell->pName ) : i;
+            p->pCornerCells[i * p->nCorners + c] = iCell >= 0 ? SC_LibCell( pLibC, iCell ) : pCell;
+        }
+        if ( p->pPiDrive )
+            p->pCornerDrive[c] = Abc_SclCellCorner( p, p->pPiDrive, c );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes timing of one object in all corners.]
+
+  Description [Same as Abc_SclTimeNodeInt() but the timing is computed
+  for every corner and the timing of the corner with the worst slack is
+  written into the regular arrays of the manager. This way the rest of 
+  the sizing code optimizes the worst-corner slack without changes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclTimeMergeCorners( SC_Man * p, Abc_Obj_t * pObj )
+{
+    // the arrival and the departure are taken from the same corner, 
+    // so that their sum is the longest path through the object in that corner
+    SC_Pair * pTimes = Abc_SclObjTimeC( p, pObj, 0 );
+    SC_Pair * pDepts = Abc_SclObjDeptC( p, pObj, 0 );
+    float Path, PathMax = -ABC_INFINITY;
+    int c, cWorst = 0;
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        Path = Abc_MaxFloat( pTimes[c].rise + pDepts[c].rise, pTimes[c].fall + pDepts[c].fall );
+        if ( PathMax < Path )
+            PathMax = Path, cWorst = c;
+    }
+    *Abc_SclObjTime(p, pObj) = pTimes[cWorst];
+    *Abc_SclObjSlew(p, pObj) = *Abc_SclObjSlewC(p, pObj, cWorst);
+    *Abc_SclObjDept(p, pObj) = pDepts[cWorst];
+}
+void Abc_SclTimeNodeCorners( SC_Man * p, Abc_Obj_t * pObj, int fDept, int * pnEstNodes )
+{
+    SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
+    SC_Pair Load = *pLoad;
+    SC_Cell * pCell, * pCellC;
+    Abc_Obj_t * pFanin;
+    float Value = p->EstLoadMax ? Abc_SclObjLoadValue( p, pObj ) : 0;
+    float EstDelta = 0;
+    int c, k;
+    if ( Abc_ObjIsCi(pObj) )
+    {
+        assert( !fDept );
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            SC_PairClean( Abc_SclObjTimeC(p, pObj, c) );
+            SC_PairClean( Abc_SclObjSlewC(p, pObj, c) );
+            if ( p->pCornerDrive[c] != NULL )
+                Scl_LibHandleInputDriver( p->pCornerDrive[c], pLoad, Abc_SclObjTimeC(p, pObj, c), Abc_SclObjSlewC(p, pObj, c) );
+        }
+        Abc_SclTimeMergeCorners( p, pObj );
+        return;
+    }
+    if ( Abc_ObjIsCo(pObj) )
+    {
+        if ( !fDept )
+        {
+            for ( c = 0; c < p->nCorners; c++ )
+                *Abc_SclObjTimeC(p, pObj, c) = *Abc_SclObjTimeC(p, Abc_ObjFanin0(pObj), c);
+            Abc_SclTimeMergeCorners( p, pObj );
+            Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
+            Vec_QueUpdate( p->vQue, pObj->iData );
+        }
+        return;
+    }
+    assert( Abc_ObjIsNode(pObj) );
+    if ( p->EstLoadMax && Value > 1 )
+    {
+        Load.rise = p->EstLoadAve * p->EstLoadMax;
+        Load.fall = p->EstLoadAve * p->EstLoadMax;
+        EstDelta  = p->EstLinear * log( Value );
+        (*pnEstNodes)++;
+    }
+    pCell = Abc_SclObjCell( pObj );
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        pCellC = Abc_SclCellCorner( p, pCell, c );
+        if ( fDept )
+        {
+            SC_Pair Dept = *Abc_SclObjDeptC( p, pObj, c );
+            Dept.rise += EstDelta;
+            Dept.fall += EstDelta;
+            Abc_ObjForEachFanin( pObj, pFanin, k )
+                Scl_LibPinDeparture( Scl_CellPinTime(pCellC, k), Abc_SclObjDeptC(p, pFanin, c), Abc_SclObjSlewC(p, pFanin, c), &Load, &Dept );
+        }
+        else
+        {
+            SC_Pair * pArrOut  = Abc_SclObjTimeC( p, pObj, c );
+            SC_Pair * pSlewOut = Abc_SclObjSlewC( p, pObj, c );
+            SC_PairClean( pArrOut );
+            SC_PairClean( pSlewOut );
+            Abc_ObjForEachFanin( pObj, pFanin, k )
+                Scl_LibPinArrival( Scl_CellPinTime(pCellC, k), Abc_SclObjTimeC(p, pFanin, c), Abc_SclObjSlewC(p, pFanin, c), &Load, pArrOut, pSlewOut );
+            pArrOut->rise += EstDelta;
+            pArrOut->fall += EstDelta;
+        }
+    }
+    if ( fDept )
+    {
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Abc_SclTimeMergeCorners( p, pFanin );
+    }
+    else
+        Abc_SclTimeMergeCorners( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes departure time of one object in all corners.]
+
+  Description [Pulls the departure times from the fanouts, similar to
+  Abc_SclDeptObj(). Does not modify the fanouts, so it can be called
+  for different objects of the same level concurrently.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclDeptObjCorners( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair Load, Dept;
+    SC_Cell * pCell;
+    Abc_Obj_t * pFanout, * pFanin;
+    float Value, EstDelta;
+    int c, i, k;
+    for ( c = 0; c < p->nCorners; c++ )
+        SC_PairClean( Abc_SclObjDeptC(p, pObj, c) );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_ObjIsNode(pFanout) )
+            continue;
+        Load     = *Abc_SclObjLoad( p, pFanout );
+        Value    = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        EstDelta = 0;
+        if ( p->EstLoadMax && Value > 1 )
+        {
+            Load.rise = p->EstLoadAve * p->EstLoadMax;
+            Load.fall = p->EstLoadAve * p->EstLoadMax;
+            EstDelta  = p->EstLinear * log( Value );
+        }
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            pCell = Abc_SclCellCorner( p, Abc_SclObjCell(pFanout), c );
+            Dept  = *Abc_SclObjDeptC( p, pFanout, c );
+            Dept.rise += EstDelta;
+            Dept.fall += EstDelta;
+            Abc_ObjForEachFanin( pFanout, pFanin, k )
+                if ( pFanin == pObj )
+                    Scl_LibPinDeparture( Scl_CellPinTime(pCell, k), Abc_SclObjDeptC(p, pObj, c), Abc_SclObjSlewC(p, pObj, c), &Load, &Dept );
+        }
+    }
+    Abc_SclTimeMergeCorners( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the delay in each corner.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeCornersPrint( SC_Man * p )
+{
+    Abc_Obj_t * pObj;
+    float MaxDelay;
+    int c, i;
+    for ( c = 0; c < p->nCorners; c++ )
+    {
+        MaxDelay = 0;
+        Abc_NtkForEachCo( p->pNtk, pObj, i )
+            MaxDelay = Abc_MaxFloat( MaxDelay, Abc_MaxFloat(Abc_SclObjTimeC(p, pObj, c)->rise, Abc_SclObjTimeC(p, pObj, c)->fall) );
+        printf( "Corner %d:  Delay =%9.2f ps  Lib = %s\n", c, MaxDelay, Abc_SclManCorner(p, c)->pName );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -197,6 +197,93 @@ int Abc_SclCheckOverlap( Abc_Ntk_t * pNtk, Vec_Int_t * vNodes )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Downsizes the nodes in batches evaluated on several threads.]
+
+  Description [Takes the nodes from the queue in the order of decreasing
+  area, a batch at a time. All nodes of the batch are evaluated in parallel
+  against the same timing. Then the successful changes are committed in
+  the same order, unless the window of a node overlaps with the window of
+  a node changed before in this round, in which case the node is returned
+  in vTryLater. Since the timing is only updated after the round, the
+  nodes see the same timing as in the serial evaluation, but the window
+  timing is computed locally, so the results may differ slightly. The
+  nodes tried later are evaluated without need. Returns the number of
+  changes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclDnsizeBatch( SC_Man * p, SC_SizePars * pPars, Vec_Int_t * vTryLater, int * pnAttempt, int * pnOverlap )
+{
+    int nBatchMax        = 1000 * p->nThreads;
+    Vec_Int_t * vCands   = Vec_IntAlloc( nBatchMax );
+    Vec_Wec_t * vRecalcs = Vec_WecAlloc( nBatchMax );
+    Vec_Wec_t * vEvals   = Vec_WecAlloc( nBatchMax );
+    Vec_Int_t * vGates   = Vec_IntAlloc( nBatchMax );
+    Vec_Flt_t * vGains   = Vec_FltAlloc( nBatchMax );
+    Vec_Int_t * vNodes   = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vEval    = Vec_IntAlloc( 1000 );
+    SC_Cell * pCellOld, * pCellNew;
+    Abc_Obj_t * pObj, * pTemp;
+    int i, k, gateBest, nChanges = 0;
+    abctime clk;
+    while ( Vec_QueSize(p->vNodeByGain) > 0 )
+    {
+        // collect the batch with the windows
+        clk = Abc_Clock();
+        Vec_IntClear( vCands );
+        Vec_WecClear( vRecalcs );
+        Vec_WecClear( vEvals );
+        while ( Vec_QueSize(p->vNodeByGain) > 0 && Vec_IntSize(vCands) < nBatchMax )
+        {
+            pObj = Abc_NtkObj( p->pNtk, Vec_QuePop(p->vNodeByGain) );
+            Abc_SclFindWindow( pObj, &vNodes, &vEval );
+            Vec_IntPush( vCands, Abc_ObjId(pObj) );
+            Vec_IntAppend( Vec_WecPushLevel(vRecalcs), vNodes );
+            Vec_IntAppend( Vec_WecPushLevel(vEvals), vEval );
+        }
+        p->timeCone += Abc_Clock() - clk;
+        // evaluate the batch in parallel
+        clk = Abc_Clock();
+        Abc_SclFindBestCellsParInt( p, vCands, vRecalcs, vEvals, vGates, vGains, pPars->Notches, pPars->DelayGap, 1 );
+        p->timeSize += Abc_Clock() - clk;
+        // commit the changes
+        Abc_NtkForEachObjVec( vCands, p->pNtk, pObj, i )
+        {
+            (*pnAttempt)++;
+            if ( Abc_SclCheckOverlap( p->pNtk, Vec_WecEntry(vRecalcs, i) ) )
+            {
+                (*pnOverlap)++;
+                Vec_IntPush( vTryLater, Abc_ObjId(pObj) );
+                continue;
+            }
+            if ( (gateBest = Vec_IntEntry(vGates, i)) < 0 )
+                continue;
+            pCellOld = Abc_SclObjCell( pObj );
+            pCellNew = SC_LibCell( p->pLib, gateBest );
+            Abc_SclObjSetCell( pObj, pCellNew );
+            p->SumArea += pCellNew->area - pCellOld->area;
+            Abc_NtkForEachObjVec( Vec_WecEntry(vRecalcs, i), p->pNtk, pTemp, k )
+                Abc_NodeSetTravIdCurrent( pTemp );
+            Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+            Abc_SclTimeIncInsert( p, pObj );
+            nChanges++;
+        }
+    }
+    Vec_IntFree( vCands );
+    Vec_WecFree( vRecalcs );
+    Vec_WecFree( vEvals );
+    Vec_IntFree( vGates );
+    Vec_FltFree( vGains );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vEval );
+    return nChanges;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Print cumulative statistics.]
@@ -245,7 +332,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     Abc_Obj_t * pObj;
     Vec_Int_t * vNodes, * vEvals, * vTryLater; 
     abctime clk, nRuntimeLimit = pPars->TimeOut ? pPars->TimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
-    int i, k;
+    int i, k, fBatch;
 
     if ( pPars->fVerbose )
     {
@@ -255,15 +342,17 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         printf( "UseWL =%2d. ",           pPars->fUseWireLoads );
         printf( "Target =%5d ps. ",       pPars->DelayUser );
         printf( "DelayGap =%3d ps. ",     pPars->DelayGap );
+        printf( "Threads =%2d. ",         pPars->nThreads  );
         printf( "Timeout =%4d sec",       pPars->TimeOut   );
         printf( "\n" );
     }
 
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst, pPars->nThreads );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
+    fBatch = p->nThreads > 1 && p->nCorners == 0; // window evaluation does not support timing corners
 
     // perform upsizing
     vNodes = Vec_IntAlloc( 1000 );
@@ -279,6 +368,9 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             int nAttempt = 0, nOverlap = 0, nChanges = 0;
             Vec_IntClear( vTryLater );
             Abc_NtkIncrementTravId( pNtk );
+            if ( fBatch )
+                nChanges = Abc_SclDnsizeBatch( p, pPars, vTryLater, &nAttempt, &nOverlap );
+            else
             while ( Vec_QueSize(p->vNodeByGain) > 0 )
             {
                 clk = Abc_Clock();
@@ -40,7 +40,7 @@ ABC_NAMESPACE_HEADER_START
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
-#define ABC_SCL_CUR_VERSION 8
+#define ABC_SCL_CUR_VERSION 9
 
 typedef enum  
 {
@@ -85,6 +85,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nThreads;         // the number of threads
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -102,6 +103,7 @@ struct SC_BusPars_
     int        fAddBufs;        // add buffers
     int        fBufPis;         // use CI buffering
     int        fUseWireLoads;   // wire loads
+    int        fTimingTree;     // timing-driven buffer trees
     int        fVerbose;        // verbose
     int        fVeryVerbose;    // verbose
 };
@@ -165,6 +167,8 @@ struct SC_Timing_
     SC_Surface     pCellFall;
     SC_Surface     pRiseTrans;     // -- Used to compute output slew
     SC_Surface     pFallTrans;
+    int            fRiseIndex;     // -- 'pCellRise' and 'pRiseTrans' have the same indexes
+    int            fFallIndex;     // -- 'pCellFall' and 'pFallTrans' have the same indexes
 };
 
 struct SC_Timings_ 
@@ -199,6 +203,7 @@ struct SC_Cell_
     int            unsupp;         // -- set to TRUE by parser if cell contains information we cannot handle
     float          area;
     float          leakage;
+    float          energy;         // -- average internal energy per output transition (from 'internal_power' of the output pins)
     int            areaI;
     int            leakageI;
     int            drive_strength; // -- some library files provide this field (currently unused, but may be a good hint for sizing) (not used)
@@ -223,11 +228,14 @@ struct SC_Lib_
     int            unit_time;      // -- Valid 9..12. Unit is '10^(-val)' seconds (e.g. 9=1ns, 10=100ps, 11=10ps, 12=1ps)
     float          unit_cap_fst;   // -- First part is a multiplier, second either 12 or 15 for 'pf' or 'ff'.
     int            unit_cap_snd;
+    int            unit_leak;      // -- Unit is '10^(-val)' watts (e.g. 6=1uW, 9=1nW, 12=1pW)
+    float          nom_voltage;    // -- supply voltage in volts
     Vec_Ptr_t      vWireLoads;     // NamedSet<SC_WireLoad>
     Vec_Ptr_t      vWireLoadSels;  // NamedSet<SC_WireLoadSel>
     Vec_Ptr_t      vTempls;        // NamedSet<SC_TableTempl>  
     Vec_Ptr_t      vCells;         // NamedSet<SC_Cell>
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
+    Vec_Ptr_t      vCorners;       // libraries of other timing corners (same cell names)
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
 };
@@ -344,6 +352,8 @@ static inline SC_Lib * Abc_SclLibAlloc()
     p->unit_time      = 9;
     p->unit_cap_fst   = 1;
     p->unit_cap_snd   = 12;
+    p->unit_leak      = 9;
+    p->nom_voltage    = 1;
     return p;
 }
 
@@ -442,6 +452,7 @@ static inline void Abc_SclLibFree( SC_Lib * p )
     SC_WireLoadSel * pWLS;
     SC_TableTempl * pTempl;
     SC_Cell * pCell;
+    SC_Lib * pLib;
     int i;
     SC_LibForEachWireLoad( p, pWL, i )
         Abc_SclWireLoadFree( pWL );
@@ -456,6 +467,9 @@ static inline void Abc_SclLibFree( SC_Lib * p )
         Abc_SclCellFree( pCell );
     Vec_PtrErase( &p->vCells );
     Vec_PtrErase( &p->vCellClasses );
+    Vec_PtrForEachEntry( SC_Lib *, &p->vCorners, pLib, i )
+        Abc_SclLibFree( pLib );
+    Vec_PtrErase( &p->vCorners );
     ABC_FREE( p->pName );
     ABC_FREE( p->pFileName );
     ABC_FREE( p->default_wire_load );
@@ -516,21 +530,204 @@ static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 
     return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Batched lookup table delay computation.]
+
+  Description [Evaluates the table in nPoints (slew, load) points. The
+  sample points are found first, while the interpolation is performed in
+  a separate loop over contiguous arrays, which is vectorized by the
+  compiler. Repeated coordinates are searched only once. The results are
+  the same as those of Scl_LibLookup().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SCL_LOOKUP_BATCH 16
+
+static inline int Scl_LibLookupIndex( float * pIndex, int nIndex, float Value )
+{
+    int i;
+    for ( i = 1; i < nIndex-1; i++ )
+        if ( pIndex[i] > Value )
+            break;
+    return i-1;
+}
+static inline void Scl_LibLookupBatch( SC_Surface * p, float * pSlews, float * pLoads, float * pRes, int nPoints )
+{
+    float D00[SCL_LOOKUP_BATCH], D01[SCL_LOOKUP_BATCH], D10[SCL_LOOKUP_BATCH], D11[SCL_LOOKUP_BATCH];
+    float SFrac[SCL_LOOKUP_BATCH], LFrac[SCL_LOOKUP_BATCH];
+    float * pIndex0, * pIndex1, * pDataS = NULL, * pDataS1 = NULL;
+    float slew = 0, load = 0, sfrac = 0, lfrac = 0;
+    int i, k, n, s = -1, l = -1;
+
+    // handle constant table
+    if ( Vec_FltSize(&p->vIndex0) == 1 && Vec_FltSize(&p->vIndex1) == 1 )
+    {
+        Vec_Flt_t * vTemp = (Vec_Flt_t *)Vec_PtrEntry(&p->vData, 0);
+        assert( Vec_PtrSize(&p->vData) == 1 );
+        assert( Vec_FltSize(vTemp) == 1 );
+        for ( i = 0; i < nPoints; i++ )
+            pRes[i] = Vec_FltEntry(vTemp, 0);
+        return;
+    }
+
+    pIndex0 = Vec_FltArray(&p->vIndex0);
+    pIndex1 = Vec_FltArray(&p->vIndex1);
+    for ( i = 0; i < nPoints; i += SCL_LOOKUP_BATCH )
+    {
+        n = Abc_MinInt( SCL_LOOKUP_BATCH, nPoints - i );
+        // find closest sample points in surface
+        for ( k = 0; k < n; k++ )
+        {
+            if ( s == -1 || pSlews[i+k] != slew )
+            {
+                slew    = pSlews[i+k];
+                s       = Scl_LibLookupIndex( pIndex0, Vec_FltSize(&p->vIndex0), slew );
+                sfrac   = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+                pDataS  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s) );
+                pDataS1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1) );
+            }
+            if ( l == -1 || pLoads[i+k] != load )
+            {
+                load    = pLoads[i+k];
+                l       = Scl_LibLookupIndex( pIndex1, Vec_FltSize(&p->vIndex1), load );
+                lfrac   = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+            }
+            SFrac[k] = sfrac;
+            LFrac[k] = lfrac;
+            D00[k]   = pDataS [l];
+            D01[k]   = pDataS [l+1];
+            D10[k]   = pDataS1[l];
+            D11[k]   = pDataS1[l+1];
+        }
+        // interpolate (or extrapolate) function values from sample points
+        for ( k = 0; k < n; k++ )
+        {
+            float p0 = D00[k] + LFrac[k] * (D01[k] - D00[k]);
+            float p1 = D10[k] + LFrac[k] * (D11[k] - D10[k]);
+            pRes[i+k] = p0 + SFrac[k] * (p1 - p0);
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Lookup of two tables with the same indexes.]
+
+  Description [The delay and the slew tables of a timing arc are looked 
+  up at the same (slew, load) point. When their indexes are the same 
+  (fSame is set by Abc_SclLinkCells), the sample points are found once 
+  for both tables. The results are the same as those of Scl_LibLookup().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Scl_LibLookupPair( SC_Surface * pA, SC_Surface * pB, int fSame, float slew, float load, float * pResA, float * pResB )
+{
+    float * pIndex0, * pIndex1, * pDataA, * pDataA1, * pDataB, * pDataB1;
+    float sfrac, lfrac, p0, p1;
+    int s, l;
+    if ( !fSame || (Vec_FltSize(&pA->vIndex0) == 1 && Vec_FltSize(&pA->vIndex1) == 1) )
+    {
+        *pResA = Scl_LibLookup( pA, slew, load );
+        *pResB = Scl_LibLookup( pB, slew, load );
+        return;
+    }
+    // find closest sample points in surface
+    pIndex0 = Vec_FltArray(&pA->vIndex0);
+    pIndex1 = Vec_FltArray(&pA->vIndex1);
+    s = Scl_LibLookupIndex( pIndex0, Vec_FltSize(&pA->vIndex0), slew );
+    l = Scl_LibLookupIndex( pIndex1, Vec_FltSize(&pA->vIndex1), load );
+    sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+    lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+    // interpolate (or extrapolate) function values from sample points
+    pDataA  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&pA->vData, s) );
+    pDataA1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&pA->vData, s+1) );
+    p0 = pDataA [l] + lfrac * (pDataA [l+1] - pDataA [l]);
+    p1 = pDataA1[l] + lfrac * (pDataA1[l+1] - pDataA1[l]);
+    *pResA = p0 + sfrac * (p1 - p0);
+    pDataB  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&pB->vData, s) );
+    pDataB1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&pB->vData, s+1) );
+    p0 = pDataB [l] + lfrac * (pDataB [l+1] - pDataB [l]);
+    p1 = pDataB1[l] + lfrac * (pDataB1[l+1] - pDataB1[l]);
+    *pResB = p0 + sfrac * (p1 - p0);
+}
+static inline int Scl_LibSurfaceSameIndex( SC_Surface * pA, SC_Surface * pB )
+{
+    return Vec_FltEqual(&pA->vIndex0, &pB->vIndex0) && Vec_FltEqual(&pA->vIndex1, &pB->vIndex1) && 
+        Vec_PtrSize(&pA->vData) == Vec_PtrSize(&pB->vData);
+}
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
+    float CellRise, CellFall, TransRise, TransFall;
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->fall, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->rise, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->fall, pLoad->fall) );
+        Scl_LibLookupPair( &pTime->pCellRise, &pTime->pRiseTrans, pTime->fRiseIndex, pSlewIn->rise, pLoad->rise, &CellRise, &TransRise );
+        Scl_LibLookupPair( &pTime->pCellFall, &pTime->pFallTrans, pTime->fFallIndex, pSlewIn->fall, pLoad->fall, &CellFall, &TransFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + CellRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + CellFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                TransRise );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                TransFall );
     }
     if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->fall, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->rise, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->fall, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->rise, pLoad->fall) );
+        Scl_LibLookupPair( &pTime->pCellRise, &pTime->pRiseTrans, pTime->fRiseIndex, pSlewIn->fall, pLoad->rise, &CellRise, &TransRise );
+        Scl_LibLookupPair( &pTime->pCellFall, &pTime->pFallTrans, pTime->fFallIndex, pSlewIn->rise, pLoad->fall, &CellFall, &TransFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + CellRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + CellFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                TransRise );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                TransFall );
+    }
+}
+static inline void Scl_LibPinArrivalBatch( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoads, SC_Pair * pArrOuts, SC_Pair * pSlewOuts, int nLoads )
+{
+    float SlewR[SCL_LOOKUP_BATCH], SlewF[SCL_LOOKUP_BATCH], LoadR[SCL_LOOKUP_BATCH], LoadF[SCL_LOOKUP_BATCH];
+    float CellR[SCL_LOOKUP_BATCH], CellF[SCL_LOOKUP_BATCH], TranR[SCL_LOOKUP_BATCH], TranF[SCL_LOOKUP_BATCH];
+    int i, k, n;
+    for ( i = 0; i < nLoads; i += SCL_LOOKUP_BATCH )
+    {
+        n = Abc_MinInt( SCL_LOOKUP_BATCH, nLoads - i );
+        for ( k = 0; k < n; k++ )
+        {
+            SlewR[k] = pSlewIn->rise;
+            SlewF[k] = pSlewIn->fall;
+            LoadR[k] = pLoads[i+k].rise;
+            LoadF[k] = pLoads[i+k].fall;
+        }
+        if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
+        {
+            Scl_LibLookupBatch( &pTime->pCellRise,  SlewR, LoadR, CellR, n );
+            Scl_LibLookupBatch( &pTime->pCellFall,  SlewF, LoadF, CellF, n );
+            Scl_LibLookupBatch( &pTime->pRiseTrans, SlewR, LoadR, TranR, n );
+            Scl_LibLookupBatch( &pTime->pFallTrans, SlewF, LoadF, TranF, n );
+            for ( k = 0; k < n; k++ )
+            {
+                pArrOuts[i+k].rise  = Abc_MaxFloat( pArrOuts[i+k].rise,  pArrIn->rise + CellR[k] );
+                pArrOuts[i+k].fall  = Abc_MaxFloat( pArrOuts[i+k].fall,  pArrIn->fall + CellF[k] );
+                pSlewOuts[i+k].rise = Abc_MaxFloat( pSlewOuts[i+k].rise,                TranR[k] );
+                pSlewOuts[i+k].fall = Abc_MaxFloat( pSlewOuts[i+k].fall,                TranF[k] );
+            }
+        }
+        if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
+        {
+            Scl_LibLookupBatch( &pTime->pCellRise,  SlewF, LoadR, CellR, n );
+            Scl_LibLookupBatch( &pTime->pCellFall,  SlewR, LoadF, CellF, n );
+            Scl_LibLookupBatch( &pTime->pRiseTrans, SlewF, LoadR, TranR, n );
+            Scl_LibLookupBatch( &pTime->pFallTrans, SlewR, LoadF, TranF, n );
+            for ( k = 0; k < n; k++ )
+            {
+                pArrOuts[i+k].rise  = Abc_MaxFloat( pArrOuts[i+k].rise,  pArrIn->fall + CellR[k] );
+                pArrOuts[i+k].fall  = Abc_MaxFloat( pArrOuts[i+k].fall,  pArrIn->rise + CellF[k] );
+                pSlewOuts[i+k].rise = Abc_MaxFloat( pSlewOuts[i+k].rise,                TranR[k] );
+                pSlewOuts[i+k].fall = Abc_MaxFloat( pSlewOuts[i+k].fall,                TranF[k] );
+            }
+        }
     }
 }
 static inline void Scl_LibPinDeparture( SC_Timing * pTime, SC_Pair * pDepIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pDepOut )
@@ -677,18 +874,17 @@ static inline float Scl_LibPinArrivalEstimate( SC_Cell * pCell, int iPin, float
 }
 static inline void Scl_LibHandleInputDriver( SC_Cell * pCell, SC_Pair * pLoadIn, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
-    SC_Pair LoadIn   = { 0.0, 0.0 }; // zero input load
-    SC_Pair ArrIn    = { 0.0, 0.0 }; // zero input time
-    SC_Pair SlewIn   = { 0.0, 0.0 }; // zero input slew
-    SC_Pair ArrOut0  = { 0.0, 0.0 }; // output time under zero load
-    SC_Pair ArrOut1  = { 0.0, 0.0 }; // output time under given load
-    SC_Pair SlewOut  = { 0.0, 0.0 }; // output slew under zero load 
-    pSlewOut->fall = pSlewOut->rise = 0;
+    SC_Pair ArrIn      = { 0.0, 0.0 };       // zero input time
+    SC_Pair SlewIn     = { 0.0, 0.0 };       // zero input slew
+    SC_Pair LoadIn[2]  = { {0.0, 0.0} };     // zero and given input load
+    SC_Pair ArrOut[2]  = { {0.0, 0.0} };     // output time under zero and given load
+    SC_Pair SlewOut[2] = { {0.0, 0.0} };     // output slew under zero and given load
     assert( pCell->n_inputs == 1 );
-    Scl_LibPinArrival( Scl_CellPinTime(pCell, 0), &ArrIn, &SlewIn, &LoadIn, &ArrOut0, &SlewOut );
-    Scl_LibPinArrival( Scl_CellPinTime(pCell, 0), &ArrIn, &SlewIn, pLoadIn, &ArrOut1, pSlewOut );
-    pArrOut->fall = ArrOut1.fall - ArrOut0.fall;
-    pArrOut->rise = ArrOut1.rise - ArrOut0.rise;
+    LoadIn[1] = *pLoadIn;
+    Scl_LibPinArrivalBatch( Scl_CellPinTime(pCell, 0), &ArrIn, &SlewIn, LoadIn, ArrOut, SlewOut, 2 );
+    pArrOut->fall = ArrOut[1].fall - ArrOut[0].fall;
+    pArrOut->rise = ArrOut[1].rise - ArrOut[0].rise;
+    *pSlewOut = SlewOut[1];
 }
 
 /**Function*************************************************************
@@ -734,13 +930,18 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 }
 
 /*=== sclLiberty.c ===============================================================*/
-extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
+extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, char * pCacheDir, int fVerbose, int fVeryVerbose );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
+extern Vec_Str_t *   Abc_SclWriteIntoStr( SC_Lib * p );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
+extern word          Abc_SclLibertyHash( char * pFileName, word * pnBytes );
+extern char *        Abc_SclCacheFileName( char * pCacheDir, word Hash );
+extern SC_Lib *      Abc_SclReadFromCache( char * pCacheName, word Hash, word nLibBytes );
+extern void          Abc_SclWriteCache( char * pCacheName, Vec_Str_t * vOut, word Hash, word nLibBytes );
 /*=== sclLibUtil.c ===============================================================*/
 extern void          Abc_SclHashCells( SC_Lib * p );
 extern int           Abc_SclCellFind( SC_Lib * p, char * pName );
@@ -751,6 +952,7 @@ extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
+extern int           Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner );
 extern SC_Cell *     Abc_SclFindInvertor( SC_Lib * p, int fFindBuff );
 extern SC_Cell *     Abc_SclFindSmallestGate( SC_Cell * p, float CinMin );
 extern SC_WireLoad * Abc_SclFindWireLoadModel( SC_Lib * p, float Area );
@@ -26,6 +26,13 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +40,22 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the header of the compiled library cache file, followed by the library
+// in the binary format of Abc_SclWriteScl(); the data is position-independent
+#define SCL_CACHE_MAGIC   "ABC_SCL_CACHE"
+#define SCL_CACHE_VERSION 1
+
+typedef struct Scl_CacheHead_t_ Scl_CacheHead_t;
+struct Scl_CacheHead_t_
+{
+    char       Magic[16];         // SCL_CACHE_MAGIC
+    int        Version;           // SCL_CACHE_VERSION
+    int        LibVersion;        // ABC_SCL_CUR_VERSION
+    word       Hash;              // hash of the Liberty file contents
+    word       nLibBytes;         // size of the Liberty file
+    word       nDataBytes;        // size of the binary library following the header
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -235,12 +258,12 @@ static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
 {
     int i, j, k, n;
     int version = Vec_StrGetI( vOut, pPos );
-    if ( version != ABC_SCL_CUR_VERSION )
+    // version 8 precedes the power data (leakage unit, voltage, internal energy)
+    if ( version != ABC_SCL_CUR_VERSION && version != 8 )
     { 
         Abc_Print( -1, "Wrong version of the SCL file.\n" ); 
         return 0; 
     }
-    assert( version == ABC_SCL_CUR_VERSION ); // wrong version of the file
 
     // Read non-composite fields:
     p->pName                 = Vec_StrGetS(vOut, pPos);
@@ -251,6 +274,11 @@ static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
     p->unit_time             = Vec_StrGetI(vOut, pPos);
     p->unit_cap_fst          = Vec_StrGetF(vOut, pPos);
     p->unit_cap_snd          = Vec_StrGetI(vOut, pPos);
+    if ( version >= 9 )
+    {
+        p->unit_leak         = Vec_StrGetI(vOut, pPos);
+        p->nom_voltage       = Vec_StrGetF(vOut, pPos);
+    }
 
     // Read 'wire_load' vector:
     for ( i = Vec_StrGetI(vOut, pPos); i != 0; i-- )
@@ -293,6 +321,7 @@ static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
         pCell->pName          = Vec_StrGetS(vOut, pPos);     
         pCell->area           = Vec_StrGetF(vOut, pPos);
         pCell->leakage        = Vec_StrGetF(vOut, pPos);
+        pCell->energy         = version >= 9 ? Vec_StrGetF(vOut, pPos) : 0;
         pCell->drive_strength = Vec_StrGetI(vOut, pPos);
 
         pCell->n_inputs       = Vec_StrGetI(vOut, pPos);
@@ -336,7 +365,6 @@ static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
 
             // read function
             // (possibly empty) formula is always given
-            assert( version == ABC_SCL_CUR_VERSION );
             assert( pPin->func_text == NULL );
             pPin->func_text = Vec_StrGetS(vOut, pPos); 
             if ( pPin->func_text[0] == 0 )
@@ -505,6 +533,8 @@ static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
     Vec_StrPutI( vOut, p->unit_time );
     Vec_StrPutF( vOut, p->unit_cap_fst );
     Vec_StrPutI( vOut, p->unit_cap_snd );
+    Vec_StrPutI( vOut, p->unit_leak );
+    Vec_StrPutF( vOut, p->nom_voltage );
 
     // Write 'wire_load' vector:
     Vec_StrPutI( vOut, Vec_PtrSize(&p->vWireLoads) );
@@ -551,6 +581,7 @@ static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
         Vec_StrPutS( vOut, pCell->pName );
         Vec_StrPutF( vOut, pCell->area );
         Vec_StrPutF( vOut, pCell->leakage );
+        Vec_StrPutF( vOut, pCell->energy );
         Vec_StrPutI( vOut, pCell->drive_strength );
 
         // Write 'pins': (sorted at this point; first inputs, then outputs)
@@ -610,11 +641,17 @@ static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
         }
     }
 }
-void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
+Vec_Str_t * Abc_SclWriteIntoStr( SC_Lib * p )
 {
     Vec_Str_t * vOut;
     vOut = Vec_StrAlloc( 10000 );
     Abc_SclWriteLibrary( vOut, p );
+    return vOut;
+}
+void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
+{
+    Vec_Str_t * vOut;
+    vOut = Abc_SclWriteIntoStr( p );
     if ( Vec_StrSize(vOut) > 0 )
     {
         FILE * pFile = fopen( pFileName, "wb" );
@@ -630,6 +667,139 @@ void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Compiled library cache.]
+
+  Description [The cache stores the binary library derived from a Liberty
+  file under a name given by the hash of the Liberty file contents, so that
+  the next reading of the same file skips Liberty parsing. The cache file
+  is mapped into memory and the library is read directly from the mapped
+  pages. The cache is written into a temporary file renamed at the end,
+  so that concurrent processes never see an incomplete file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Abc_SclLibertyHash( char * pFileName, word * pnBytes )
+{
+    word Hash = ABC_CONST(0xcbf29ce484222325);
+    unsigned char Buffer[1<<16];
+    FILE * pFile = fopen( pFileName, "rb" );
+    int i, nRead;
+    *pnBytes = 0;
+    if ( pFile == NULL )
+        return 0;
+    while ( (nRead = (int)fread( Buffer, 1, sizeof(Buffer), pFile )) > 0 )
+    {
+        for ( i = 0; i < nRead; i++ )
+            Hash = (Hash ^ Buffer[i]) * ABC_CONST(0x100000001b3);
+        *pnBytes += nRead;
+    }
+    fclose( pFile );
+    return Hash;
+}
+char * Abc_SclCacheFileName( char * pCacheDir, word Hash )
+{
+    int nLength = strlen(pCacheDir);
+    int fSlash  = nLength > 0 && pCacheDir[nLength-1] != '/' && pCacheDir[nLength-1] != '\\';
+    char * pFileName = ABC_ALLOC( char, nLength + 30 );
+    // print the two halves separately, because 'long' has 32 bits on Win64
+    sprintf( pFileName, "%s%s%08x%08x.scl", pCacheDir, fSlash ? "/" : "", (unsigned)(Hash >> 32), (unsigned)(Hash & 0xFFFFFFFF) );
+    return pFileName;
+}
+SC_Lib * Abc_SclReadFromCache( char * pCacheName, word Hash, word nLibBytes )
+{
+    Scl_CacheHead_t Head;
+    Vec_Str_t vData = { 0, 0, NULL };
+    SC_Lib * p = NULL;
+    char * pBuffer;
+    word nFileBytes;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pCacheName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || (word)Stat.st_size < sizeof(Scl_CacheHead_t) )
+    {
+        close( fd );
+        return NULL;
+    }
+    nFileBytes = (word)Stat.st_size;
+    pBuffer = (char *)mmap( NULL, (size_t)nFileBytes, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pBuffer == (char *)MAP_FAILED )
+        return NULL;
+#else
+    FILE * pFile = fopen( pCacheName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );  
+    nFileBytes = (word)ftell( pFile );  
+    rewind( pFile ); 
+    pBuffer = ABC_ALLOC( char, nFileBytes + 1 );
+    nFileBytes = (word)fread( pBuffer, 1, (size_t)nFileBytes, pFile );
+    fclose( pFile );
+#endif
+    // check the header before using the contents
+    if ( nFileBytes >= sizeof(Scl_CacheHead_t) )
+    {
+        memcpy( &Head, pBuffer, sizeof(Scl_CacheHead_t) );
+        if ( !strncmp(Head.Magic, SCL_CACHE_MAGIC, 16) && Head.Version == SCL_CACHE_VERSION && 
+             Head.LibVersion == ABC_SCL_CUR_VERSION && Head.Hash == Hash && Head.nLibBytes == nLibBytes && 
+             Head.nDataBytes == nFileBytes - sizeof(Scl_CacheHead_t) && Head.nDataBytes < (word)ABC_INFINITY )
+        {
+            vData.nCap   = (int)Head.nDataBytes;
+            vData.nSize  = (int)Head.nDataBytes;
+            vData.pArray = pBuffer + sizeof(Scl_CacheHead_t);
+            p = Abc_SclReadFromStr( &vData );
+        }
+    }
+#ifndef _WIN32
+    munmap( pBuffer, (size_t)nFileBytes );
+#else
+    ABC_FREE( pBuffer );
+#endif
+    return p;
+}
+void Abc_SclWriteCache( char * pCacheName, Vec_Str_t * vOut, word Hash, word nLibBytes )
+{
+    Scl_CacheHead_t Head;
+    char * pTempName = ABC_ALLOC( char, strlen(pCacheName) + 100 );
+    FILE * pFile;
+    int RetValue;
+    memset( &Head, 0, sizeof(Scl_CacheHead_t) );
+    strncpy( Head.Magic, SCL_CACHE_MAGIC, 16 );
+    Head.Version    = SCL_CACHE_VERSION;
+    Head.LibVersion = ABC_SCL_CUR_VERSION;
+    Head.Hash       = Hash;
+    Head.nLibBytes  = nLibBytes;
+    Head.nDataBytes = (word)Vec_StrSize(vOut);
+#ifndef _WIN32
+    sprintf( pTempName, "%s.%d.tmp", pCacheName, (int)getpid() );
+#else
+    sprintf( pTempName, "%s.tmp", pCacheName );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 0, "Cannot open file \"%s\" for writing.\n", pTempName );
+        ABC_FREE( pTempName );
+        return;
+    }
+    RetValue  = fwrite( &Head, sizeof(Scl_CacheHead_t), 1, pFile ) == 1;
+    RetValue &= fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile ) == (size_t)Vec_StrSize(vOut);
+    RetValue &= fclose( pFile ) == 0;
+    if ( !RetValue || rename( pTempName, pCacheName ) != 0 )
+    {
+        Abc_Print( 0, "Cannot write the library cache file \"%s\".\n", pCacheName );
+        remove( pTempName );
+    }
+    ABC_FREE( pTempName );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writing library into text file.]
@@ -716,6 +886,8 @@ static void Abc_SclWriteLibraryText( FILE * s, SC_Lib * p )
     fprintf( s, "  time_unit : \"1ps\";\n" );
     else assert( 0 );
     fprintf( s, "  capacitive_load_unit(%.1f,%s);\n",        p->unit_cap_fst, p->unit_cap_snd == 12 ? "pf" : "ff" );
+    fprintf( s, "  leakage_power_unit : \"%d%cW\";\n",        (int)pow(10.0, (p->unit_leak+2)/3*3 - p->unit_leak), "munpf"[Abc_MinInt((p->unit_leak+2)/3, 5)-1] );
+    fprintf( s, "  nom_voltage : %f;\n",                      p->nom_voltage );
     fprintf( s, "\n" );
 
     // Write 'wire_load' vector:
@@ -782,6 +954,13 @@ static void Abc_SclWriteLibraryText( FILE * s, SC_Lib * p )
             fprintf( s, "      /*  truth table = " );
             Extra_PrintHex( s, (unsigned *)Vec_WrdArray(&pPin->vFunc), pCell->n_inputs );
             fprintf( s, "  */\n" );
+            if ( pCell->energy != 0 )
+            {
+                fprintf( s, "      internal_power() {\n" );
+                fprintf( s, "        rise_power() { values(\"%f\"); }\n", pCell->energy );
+                fprintf( s, "        fall_power() { values(\"%f\"); }\n", pCell->energy );
+                fprintf( s, "      }\n" );
+            }
 
             // Write 'rtiming': (pin-to-pin timing tables for this particular output)
             assert( Vec_PtrSize(&pPin->vRTimings) == pCell->n_inputs );
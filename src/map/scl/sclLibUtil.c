@@ -314,6 +314,70 @@ void Abc_SclLinkCells( SC_Lib * p )
         Vec_PtrWriteEntry( &p->vCellClasses, k, pRepr );
     }
     Vec_PtrFree( vList );
+    // mark the timing arcs whose delay and slew tables can share the lookup
+    SC_LibForEachCell( p, pCell, i )
+    {
+        SC_Pin * pPin;
+        SC_Timings * pRTime;
+        SC_Timing * pTime;
+        int n, m;
+        SC_CellForEachPinOut( pCell, pPin, n )
+            SC_PinForEachRTiming( pPin, pRTime, k )
+                Vec_PtrForEachEntry( SC_Timing *, &pRTime->vTimings, pTime, m )
+                {
+                    pTime->fRiseIndex = Scl_LibSurfaceSameIndex( &pTime->pCellRise, &pTime->pRiseTrans );
+                    pTime->fFallIndex = Scl_LibSurfaceSameIndex( &pTime->pCellFall, &pTime->pFallTrans );
+                }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the library of another timing corner.]
+
+  Description [The corner library should contain the cells of the main
+  library with the same names and the same input pins. Returns 1 and takes
+  ownership of the corner library if it is compatible, returns 0 otherwise.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner )
+{
+    SC_Cell * pCell, * pCellC;
+    int i, k, iCell;
+    if ( p->unit_time != pCorner->unit_time || p->unit_cap_snd != pCorner->unit_cap_snd )
+    {
+        printf( "Library \"%s\" uses different units than library \"%s\".\n", pCorner->pName, p->pName );
+        return 0;
+    }
+    SC_LibForEachCell( p, pCell, i )
+    {
+        if ( pCell->n_inputs == 0 )
+            continue;
+        iCell = Abc_SclCellFind( pCorner, pCell->pName );
+        if ( iCell == -1 )
+        {
+            printf( "Cell \"%s\" is not found in library \"%s\".\n", pCell->pName, pCorner->pName );
+            return 0;
+        }
+        pCellC = SC_LibCell( pCorner, iCell );
+        if ( pCellC->n_inputs != pCell->n_inputs )
+        {
+            printf( "Cell \"%s\" has different number of inputs in library \"%s\".\n", pCell->pName, pCorner->pName );
+            return 0;
+        }
+        for ( k = 0; k < pCell->n_inputs; k++ )
+            if ( strcmp(SC_CellPin(pCell, k)->pName, SC_CellPin(pCellC, k)->pName) )
+            {
+                printf( "Cell \"%s\" has different input pins in library \"%s\".\n", pCell->pName, pCorner->pName );
+                return 0;
+            }
+    }
+    Vec_PtrPush( &p->vCorners, pCorner );
+    return 1;
 }
 
 /**Function*************************************************************
@@ -475,13 +539,11 @@ float Abc_SclComputeAverageSlew( SC_Lib * p )
 ***********************************************************************/
 int Abc_SclComputeParametersPin( SC_Lib * p, SC_Cell * pCell, int iPin, float Slew, float * pLD, float * pPD )
 {
-    SC_Pair Load0, Load1, Load2;
+    SC_Pair Loads[3];
     SC_Pair ArrIn  = { 0.0, 0.0 };
     SC_Pair SlewIn = { Slew, Slew };
-    SC_Pair ArrOut0 = { 0.0, 0.0 };
-    SC_Pair ArrOut1 = { 0.0, 0.0 };
-    SC_Pair ArrOut2 = { 0.0, 0.0 };
-    SC_Pair SlewOut = { 0.0, 0.0 };
+    SC_Pair ArrOuts[3]  = { {0.0, 0.0} };
+    SC_Pair SlewOuts[3] = { {0.0, 0.0} };
     SC_Timing * pTime = Scl_CellPinTime( pCell, iPin );
     Vec_Flt_t * vIndex = pTime ? &pTime->pCellRise.vIndex1 : NULL; // capacitance
     if ( vIndex == NULL )
@@ -494,20 +556,18 @@ int Abc_SclComputeParametersPin( SC_Lib * p, SC_Cell * pCell, int iPin, float Sl
         return 1;
     }
     // get load points
-    Load0.rise = Load0.fall = 0.0;
-    Load1.rise = Load1.fall = Vec_FltEntry( vIndex, 0 );
-    Load2.rise = Load2.fall = Vec_FltEntry( vIndex, Vec_FltSize(vIndex) - 2 );
+    Loads[0].rise = Loads[0].fall = 0.0;
+    Loads[1].rise = Loads[1].fall = Vec_FltEntry( vIndex, 0 );
+    Loads[2].rise = Loads[2].fall = Vec_FltEntry( vIndex, Vec_FltSize(vIndex) - 2 );
     // compute delay
-    Scl_LibPinArrival( pTime, &ArrIn, &SlewIn, &Load0, &ArrOut0, &SlewOut );
-    Scl_LibPinArrival( pTime, &ArrIn, &SlewIn, &Load1, &ArrOut1, &SlewOut );
-    Scl_LibPinArrival( pTime, &ArrIn, &SlewIn, &Load2, &ArrOut2, &SlewOut );
-    ArrOut0.rise = 0.5 * ArrOut0.rise + 0.5 * ArrOut0.fall;
-    ArrOut1.rise = 0.5 * ArrOut1.rise + 0.5 * ArrOut1.fall;
-    ArrOut2.rise = 0.5 * ArrOut2.rise + 0.5 * ArrOut2.fall;
+    Scl_LibPinArrivalBatch( pTime, &ArrIn, &SlewIn, Loads, ArrOuts, SlewOuts, 3 );
+    ArrOuts[0].rise = 0.5 * ArrOuts[0].rise + 0.5 * ArrOuts[0].fall;
+    ArrOuts[1].rise = 0.5 * ArrOuts[1].rise + 0.5 * ArrOuts[1].fall;
+    ArrOuts[2].rise = 0.5 * ArrOuts[2].rise + 0.5 * ArrOuts[2].fall;
     // get tangent
-    *pLD = (ArrOut2.rise - ArrOut1.rise) / ((Load2.rise - Load1.rise) / SC_CellPinCap(pCell, iPin));
+    *pLD = (ArrOuts[2].rise - ArrOuts[1].rise) / ((Loads[2].rise - Loads[1].rise) / SC_CellPinCap(pCell, iPin));
     // get constant
-    *pPD = ArrOut0.rise;
+    *pPD = ArrOuts[0].rise;
     return 1;
 }
 int Abc_SclComputeParametersCell( SC_Lib * p, SC_Cell * pCell, float Slew, float * pLD, float * pPD )
@@ -763,6 +823,8 @@ void Abc_SclLibNormalize( SC_Lib * p )
     p->default_max_out_slew *= Time;
     SC_LibForEachWireLoad( p, pWL, i )
         pWL->cap *= Load;
+    SC_LibForEachCell( p, pCell, i )
+        pCell->energy *= Load; // internal energy is measured in capacitance units times squared volts
     SC_LibForEachCell( p, pCell, i )
     SC_CellForEachPin( pCell, pPin, k )
     {
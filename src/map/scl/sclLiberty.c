@@ -882,6 +882,30 @@ void Scl_LibertyReadLoadUnit( Scl_Tree_t * p, Vec_Str_t * vOut )
     Vec_StrPutF_( vOut, 1.0 );
     Vec_StrPutI_( vOut, 12 );
 }
+int Scl_LibertyReadLeakageUnit( Scl_Tree_t * p )
+{
+    Scl_Item_t * pItem;
+    Scl_ItemForEachChildName( p, Scl_LibertyRoot(p), pItem, "leakage_power_unit" )
+    {
+        // expecting "1nW", "10uW", "100pW", etc; 6=1uW, 9=1nW, 12=1pW
+        char * pUnit = Scl_LibertyReadString(p, pItem->Head);
+        int Scale = 0, Prefix;
+        while ( *pUnit == '1' || *pUnit == '0' )
+            Scale += (*pUnit++ == '0');
+        Prefix = *pUnit == 'm' ? 3 : *pUnit == 'u' ? 6 : *pUnit == 'n' ? 9 : *pUnit == 'p' ? 12 : *pUnit == 'f' ? 15 : 0;
+        if ( Prefix == 0 || Scale > 2 )
+            break;
+        return Prefix - Scale;
+    }
+    return 9;
+}
+float Scl_LibertyReadNomVoltage( Scl_Tree_t * p )
+{
+    Scl_Item_t * pItem;
+    Scl_ItemForEachChildName( p, Scl_LibertyRoot(p), pItem, "nom_voltage" )
+        return atof(Scl_LibertyReadString(p, pItem->Head));
+    return 1;
+}
 void Scl_LibertyReadWireLoad( Scl_Tree_t * p, Vec_Str_t * vOut )
 {
     Scl_Item_t * pItem, * pChild;
@@ -1011,6 +1035,35 @@ Vec_Flt_t * Scl_LibertyReadFloatVec( char * pName )
     return vValues;
 }
 
+float Scl_LibertyReadCellEnergy( Scl_Tree_t * p, Scl_Item_t * pCell )
+{
+    // averages the 'rise_power' and 'fall_power' tables of the output pins
+    Scl_Item_t * pPin, * pPower, * pTable, * pItem;
+    Vec_Flt_t * vValues;
+    double Sum = 0;
+    float Entry;
+    int i, nTables = 0;
+    Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
+    {
+        if ( !Scl_LibertyReadPinFormula(p, pPin) ) // skip input pin
+            continue;
+        Scl_ItemForEachChildName( p, pPin, pPower, "internal_power" )
+        Scl_ItemForEachChild( p, pPower, pTable )
+        {
+            if ( Scl_LibertyCompare(p, pTable->Key, "rise_power") && Scl_LibertyCompare(p, pTable->Key, "fall_power") && Scl_LibertyCompare(p, pTable->Key, "power") )
+                continue;
+            Scl_ItemForEachChildName( p, pTable, pItem, "values" )
+            {
+                vValues = Scl_LibertyReadFloatVec( Scl_LibertyReadString(p, pItem->Head) );
+                Vec_FltForEachEntry( vValues, Entry, i )
+                    Sum += Entry / Vec_FltSize(vValues);
+                nTables += (int)(Vec_FltSize(vValues) > 0);
+                Vec_FltFree( vValues );
+            }
+        }
+    }
+    return nTables ? (float)(Sum / nTables) : 0;
+}
 void Scl_LibertyDumpTables( Vec_Str_t * vOut, Vec_Flt_t * vInd1, Vec_Flt_t * vInd2, Vec_Flt_t * vValues )
 {
     int i; float Entry;
@@ -1453,6 +1506,8 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     Vec_StrPutF_( vOut, Scl_LibertyReadDefaultMaxTrans(p) );
     Vec_StrPutI_( vOut, Scl_LibertyReadTimeUnit(p) );
     Scl_LibertyReadLoadUnit( p, vOut );
+    Vec_StrPutI_( vOut, Scl_LibertyReadLeakageUnit(p) );
+    Vec_StrPutF_( vOut, Scl_LibertyReadNomVoltage(p) );
     Vec_StrPut_( vOut );
     Vec_StrPut_( vOut );
 
@@ -1510,6 +1565,7 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
         Vec_StrPutF_( vOut, pName ? atof(pName) : 1 );
         pName = Scl_LibertyReadCellLeakage(p, pCell);
         Vec_StrPutF_( vOut, pName ? atof(pName) : 0 );
+        Vec_StrPutF_( vOut, Scl_LibertyReadCellEnergy(p, pCell) );
         Vec_StrPutI_( vOut, Scl_LibertyReadDeriveStrength(p, pCell) );
         // pin count
         nOutputs = Scl_LibertyReadCellOutputNum( p, pCell );
@@ -1673,24 +1729,59 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+SC_Lib * Abc_SclReadLiberty( char * pFileName, char * pCacheDir, int fVerbose, int fVeryVerbose )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
+    word Hash = 0, nLibBytes = 0;
+    char * pCacheName = NULL;
+    if ( pCacheDir )
+    {
+        abctime clk = Abc_Clock();
+        Hash = Abc_SclLibertyHash( pFileName, &nLibBytes );
+        pCacheName = Abc_SclCacheFileName( pCacheDir, Hash );
+        pLib = Abc_SclReadFromCache( pCacheName, Hash, nLibBytes );
+        if ( pLib != NULL )
+        {
+            if ( fVerbose )
+            {
+                Abc_Print( 1, "Library \"%s\" is loaded from cache \"%s\".  ", pFileName, pCacheName );
+                Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            }
+            ABC_FREE( pCacheName );
+            pLib->pFileName = Abc_UtilStrsav( pFileName );
+            Abc_SclLibNormalize( pLib );
+            return pLib;
+        }
+    }
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
     if ( p == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
 //    Scl_LibertyParseDump( p, "temp_.lib" );
     // collect relevant data
     vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
     Scl_LibertyStop( p, fVeryVerbose );
     if ( vStr == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
+    if ( pCacheName )
+    {
+        Abc_SclWriteCache( pCacheName, vStr, Hash, nLibBytes );
+        ABC_FREE( pCacheName );
+    }
     pLib->pFileName = Abc_UtilStrsav( pFileName );
     Abc_SclLibNormalize( pLib );
     Vec_StrFree( vStr );
@@ -105,6 +105,61 @@ void Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubtr )
     Abc_SclObjLoad(p, pObj)->rise += fSubtr ? -Load : Load;
     Abc_SclObjLoad(p, pObj)->fall += fSubtr ? -Load : Load;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the wire load of a net using placement.]
+
+  Description [The wire length is estimated as the half-perimeter of the
+  bounding box of the placed terminals of the net, multiplied by the
+  Steiner tree correction factor for the given number of terminals
+  (C.-K. Cheng, "RISA: accurate and efficient placement routability
+  modeling", ICCAD'94). Unplaced terminals are skipped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline float Abc_SclSteinerFactor( int nPins )
+{
+    static float Factors[11] = { 1.00, 1.00, 1.00, 1.00, 1.08, 1.15, 1.22, 1.28, 1.34, 1.40, 1.45 };
+    if ( nPins <= 10 )
+        return Factors[nPins];
+    if ( nPins <= 15 )
+        return 1.45 + 0.048 * (nPins - 10);
+    if ( nPins <= 50 )
+        return 1.69 + 0.031 * (nPins - 15);
+    return 2.79 + 0.02616 * (nPins - 50);
+}
+float Abc_SclFindPlaceLoad( SC_Man * p, Abc_Obj_t * pObj )
+{
+    Abc_Obj_t * pFanout;
+    float xMin, xMax, yMin, yMax;
+    int i, nPins = 1;
+    if ( !Abc_SclObjIsPlaced(p, pObj) )
+        return 0;
+    xMin = xMax = Abc_SclObjPlaceX( p, pObj );
+    yMin = yMax = Abc_SclObjPlaceY( p, pObj );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_SclObjIsPlaced(p, pFanout) )
+            continue;
+        xMin = Abc_MinFloat( xMin, Abc_SclObjPlaceX(p, pFanout) );
+        xMax = Abc_MaxFloat( xMax, Abc_SclObjPlaceX(p, pFanout) );
+        yMin = Abc_MinFloat( yMin, Abc_SclObjPlaceY(p, pFanout) );
+        yMax = Abc_MaxFloat( yMax, Abc_SclObjPlaceY(p, pFanout) );
+        nPins++;
+    }
+    return p->PlaceCap * Abc_SclSteinerFactor(nPins) * ((xMax - xMin) + (yMax - yMin));
+}
+void Abc_SclAddPlaceLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubtr )
+{
+    float Load = fSubtr ? Vec_FltEntry( p->vPlaceLoads, Abc_ObjId(pObj) ) : Abc_SclFindPlaceLoad( p, pObj );
+    Vec_FltWriteEntry( p->vPlaceLoads, Abc_ObjId(pObj), fSubtr ? 0 : Load );
+    Abc_SclObjLoad(p, pObj)->rise += fSubtr ? -Load : Load;
+    Abc_SclObjLoad(p, pObj)->fall += fSubtr ? -Load : Load;
+}
 void Abc_SclComputeLoad( SC_Man * p )
 {
     Abc_Obj_t * pObj, * pFanin;
@@ -137,7 +192,16 @@ void Abc_SclComputeLoad( SC_Man * p )
         pLoad->fall += pLoadPo->fall;
     }
     // add wire load
-    if ( p->pWLoadUsed != NULL )
+    if ( p->vPlace != NULL )
+    {
+        if ( p->vPlaceLoads == NULL )
+            p->vPlaceLoads = Vec_FltStart( p->nObjs );
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclAddPlaceLoad( p, pObj, 0 );
+        Abc_NtkForEachPi( p->pNtk, pObj, i )
+            Abc_SclAddPlaceLoad( p, pObj, 0 );
+    }
+    else if ( p->pWLoadUsed != NULL )
     {
         if ( p->vWireCaps == NULL )
             p->vWireCaps = Abc_SclFindWireCaps( p->pWLoadUsed, Abc_NtkGetFanoutMax(p->pNtk) );
@@ -211,6 +275,34 @@ void Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell *
         pLoad->fall += pPinNew->fall_cap - pPinOld->fall_cap;
     }
 }
+void Abc_SclUpdateLoadPlace( SC_Man * p, Abc_Obj_t * pObj, float X, float Y )
+{
+    Abc_Obj_t * pFanin;
+    int k;
+    assert( p->vPlace != NULL );
+    // subtract the wire loads of the nets that include this object (a repeated fanin is one net)
+    if ( Abc_ObjIsNode(pObj) || Abc_ObjIsPi(pObj) )
+        Abc_SclAddPlaceLoad( p, pObj, 1 );
+    Abc_ObjForEachFanin( pObj, pFanin, k )
+        if ( (Abc_ObjIsNode(pFanin) || Abc_ObjIsPi(pFanin)) && Abc_NodeFindFanin(pObj, pFanin) == k )
+            Abc_SclAddPlaceLoad( p, pFanin, 1 );
+    // move the object
+    Vec_FltFillExtra( p->vPlace, 2 * Abc_NtkObjNumMax(p->pNtk), ABC_INFINITY );
+    Vec_FltWriteEntry( p->vPlace, 2*Abc_ObjId(pObj)+0, X );
+    Vec_FltWriteEntry( p->vPlace, 2*Abc_ObjId(pObj)+1, Y );
+    // add the wire loads and schedule timing update
+    if ( Abc_ObjIsNode(pObj) || Abc_ObjIsPi(pObj) )
+    {
+        Abc_SclAddPlaceLoad( p, pObj, 0 );
+        Abc_SclTimeIncInsert( p, pObj );
+    }
+    Abc_ObjForEachFanin( pObj, pFanin, k )
+        if ( (Abc_ObjIsNode(pFanin) || Abc_ObjIsPi(pFanin)) && Abc_NodeFindFanin(pObj, pFanin) == k )
+        {
+            Abc_SclAddPlaceLoad( p, pFanin, 0 );
+            Abc_SclTimeIncInsert( p, pFanin );
+        }
+}
 void Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout )
 {
     SC_Pin * pPin;
@@ -82,7 +82,7 @@ std::string Abc_SclOnehotClass(int maxsize, int size)
 void Abc_ML_SclGenDataset(SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars)
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nThreads );
     std::string designName = pNtk->pName;
     const std::string extension = ".el";
     std::string name_with_extension = designName + extension;
@@ -1054,7 +1054,7 @@ void Abc_ML_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars *
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
     //Abc_SclMinsizePerform(pLib, pNtk, 0, 0 ); // start with min-size network
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nThreads );
     assert( p->vGatesBest == NULL );
     // perform upsizing -- method 1 working on critical path nodes
     /*
@@ -1163,7 +1163,7 @@ void Abc_ML_SclUpsizePerformInt2( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars *
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nThreads );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
@@ -0,0 +1,130 @@
+/**CFile****************************************************************
+
+  FileName    [sclPlace.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Reading placement of the mapped network.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: sclPlace.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+#include "misc/util/utilNam.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reads placement in GSRC Bookshelf format.]
+
+  Description [Each line of the ".pl" file has the form "<name> <x> <y>"
+  optionally followed by ": <orient>" and "/FIXED". The names are matched
+  with the names of CIs, internal nodes and COs of the mapped network
+  (in this order, if the same name is used twice). The coordinates are
+  attached to the network and used by the SCL timing manager to compute
+  the wire loads. Objects without coordinates are treated as unplaced.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclReadPlacement( Abc_Ntk_t * pNtk, char * pFileName, float PlaceCap, int fVerbose )
+{
+    Abc_Nam_t * pNames;
+    Vec_Int_t * vName2Obj;
+    Vec_Flt_t * vPlace;
+    Abc_Obj_t * pObj;
+    char * pBuffer, * pName, * pX, * pY;
+    int i, k, iName, fFound, nLines = 0, nPlaced = 0, nUnknown = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileName );
+        return 0;
+    }
+    // hash the object names
+    pNames    = Abc_NamStart( Abc_NtkObjNumMax(pNtk), 20 );
+    vName2Obj = Vec_IntAlloc( Abc_NtkObjNumMax(pNtk) + 1 );
+    for ( i = 0; i < 3; i++ )
+    {
+        Abc_NtkForEachObj( pNtk, pObj, k )
+        {
+            if ( (i == 0 && !Abc_ObjIsCi(pObj)) || (i == 1 && !Abc_ObjIsNode(pObj)) || (i == 2 && !Abc_ObjIsCo(pObj)) )
+                continue;
+            iName = Abc_NamStrFindOrAdd( pNames, Abc_ObjName(pObj), &fFound );
+            if ( !fFound )
+                Vec_IntSetEntryFull( vName2Obj, iName, Abc_ObjId(pObj) );
+        }
+    }
+    // read the coordinates
+    vPlace  = Vec_FltAlloc( 0 );
+    Vec_FltFill( vPlace, 2 * Abc_NtkObjNumMax(pNtk), ABC_INFINITY );
+    pBuffer = ABC_ALLOC( char, 10000 );
+    while ( fgets( pBuffer, 10000, pFile ) != NULL )
+    {
+        nLines++;
+        pName = strtok( pBuffer, " \t\r\n" );
+        if ( pName == NULL || pName[0] == '#' || !strcmp(pName, "UCLA") )
+            continue;
+        pX = strtok( NULL, " \t\r\n" );
+        pY = pX ? strtok( NULL, " \t\r\n" ) : NULL;
+        if ( pY == NULL )
+        {
+            printf( "Line %d of file \"%s\" does not have two coordinates.\n", nLines, pFileName );
+            Vec_FltFree( vPlace );
+            vPlace = NULL;
+            break;
+        }
+        iName = Abc_NamStrFind( pNames, pName );
+        if ( iName <= 0 || iName >= Vec_IntSize(vName2Obj) )
+        {
+            nUnknown++;
+            continue;
+        }
+        pObj = Abc_NtkObj( pNtk, Vec_IntEntry(vName2Obj, iName) );
+        Vec_FltWriteEntry( vPlace, 2*Abc_ObjId(pObj)+0, (float)atof(pX) );
+        Vec_FltWriteEntry( vPlace, 2*Abc_ObjId(pObj)+1, (float)atof(pY) );
+        nPlaced++;
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    Abc_NamStop( pNames );
+    Vec_IntFree( vName2Obj );
+    if ( vPlace == NULL )
+        return 0;
+    // attach the placement to the network
+    Vec_FltFreeP( &pNtk->vPlace );
+    pNtk->vPlace   = vPlace;
+    pNtk->PlaceCap = PlaceCap;
+    if ( fVerbose )
+        printf( "Placed %d objects (out of %d).  Skipped %d unknown names.  Wire cap = %.4f ff per unit.\n",
+            nPlaced, Abc_NtkCiNum(pNtk) + Abc_NtkNodeNum(pNtk) + Abc_NtkCoNum(pNtk), nUnknown, PlaceCap );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
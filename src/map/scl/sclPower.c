@@ -0,0 +1,379 @@
+/**CFile****************************************************************
+
+  FileName    [sclPower.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Simulation-based power estimation of the mapped network.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: sclPower.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SCL_POW_THR_MAX 64
+
+typedef struct Scl_PowMan_t_ Scl_PowMan_t;
+struct Scl_PowMan_t_
+{
+    Abc_Ntk_t *      pNtk;          // the mapped network
+    Vec_Wrd_t *      vPats;         // CI patterns (nWords words for each CI) or NULL for random patterns
+    int              nWords;        // the number of simulation words
+    int              nPats;         // the number of simulation patterns
+    int              nMintsMax;     // the largest number of minterms of a cell
+};
+
+typedef struct Scl_PowThr_t_ Scl_PowThr_t;
+struct Scl_PowThr_t_
+{
+    Scl_PowMan_t *   pMan;          // the shared data
+    int              iWordStart;    // the first word simulated by this thread
+    int              iWordStop;     // the word following the last word
+    word *           pSims;         // the last simulated word of each object
+    word *           pMints;        // scratch space for cell evaluation
+    int *            pToggles;      // the number of transitions of each object
+    int              nTrans;        // the number of simulated transitions
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reads simulation vectors.]
+
+  Description [Each line of the file contains one pattern, which is a
+  string of 0s and 1s, one for each CI, in the order of CIs. White spaces
+  inside the pattern are ignored. Lines starting with '#' are skipped.
+  The consecutive patterns are treated as consecutive clock cycles.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Abc_SclPowerReadVectors( Abc_Ntk_t * pNtk, char * pFileName, int * pnPats )
+{
+    Vec_Int_t * vBits;
+    Vec_Wrd_t * vPats = NULL;
+    char * pBuffer, * pTemp;
+    int i, k, nWords, nCis = Abc_NtkCiNum(pNtk), nPats = 0, nLines = 0, fError = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    vBits   = Vec_IntAlloc( 1 << 16 );
+    pBuffer = ABC_ALLOC( char, 1 << 20 );
+    while ( fgets( pBuffer, 1 << 20, pFile ) != NULL )
+    {
+        nLines++;
+        if ( pBuffer[0] == '#' )
+            continue;
+        for ( k = 0, pTemp = pBuffer; *pTemp; pTemp++ )
+        {
+            if ( *pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n' )
+                continue;
+            if ( (*pTemp != '0' && *pTemp != '1') || k == nCis )
+                break;
+            Vec_IntPush( vBits, *pTemp == '1' );
+            k++;
+        }
+        if ( k == 0 && *pTemp == 0 ) // empty line
+            continue;
+        if ( *pTemp != 0 || k != nCis )
+        {
+            printf( "Line %d of file \"%s\" is not a pattern of %d zeros and ones.\n", nLines, pFileName, nCis );
+            fError = 1;
+            break;
+        }
+        nPats++;
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    if ( !fError && nPats < 2 )
+    {
+        printf( "File \"%s\" should contain at least two patterns.\n", pFileName );
+        fError = 1;
+    }
+    if ( !fError )
+    {
+        // transpose the patterns
+        nWords = Abc_Bit6WordNum( nPats );
+        vPats  = Vec_WrdStart( nCis * nWords );
+        for ( i = 0; i < nPats; i++ )
+            for ( k = 0; k < nCis; k++ )
+                if ( Vec_IntEntry(vBits, i * nCis + k) )
+                    Abc_InfoSetBit( (unsigned *)Vec_WrdEntryP(vPats, k * nWords), i );
+        *pnPats = nPats;
+    }
+    Vec_IntFree( vBits );
+    return vPats;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the network.]
+
+  Description [Random patterns of a CI are derived from the CI index and
+  the word index. Each thread simulates its own range of words by going
+  through the objects in the topological order, one word at a time. The
+  previous word of each object is kept to count the transition at the
+  word boundary. The thread starts by simulating the word before its
+  range, so the result does not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Abc_SclPowerRandom( int iCi, int iWord )
+{
+    word x = ((word)iCi << 32) + (word)iWord + ABC_CONST(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+static inline word Abc_SclPowerSimNode( Abc_Obj_t * pObj, word * pSims, word * pMints )
+{
+    SC_Cell * pCell = Abc_SclObjCell( pObj );
+    word * pTruth, Sim;
+    int m, v, nMints;
+    if ( pCell == NULL ) // constant or barrier buffer
+        return Abc_ObjFaninNum(pObj) == 0 ? (Abc_NodeIsConst1(pObj) ? ~(word)0 : 0) : pSims[Abc_ObjFaninId0(pObj)];
+    pTruth = Vec_WrdArray( SC_CellFunc(pCell) );
+    nMints = 1 << pCell->n_inputs;
+    for ( m = 0; m < nMints; m++ )
+        pMints[m] = ((pTruth[m >> 6] >> (m & 63)) & 1) ? ~(word)0 : 0;
+    // cofactor the truth table with respect to the fanins, starting from the lowest variable
+    for ( v = 0; v < pCell->n_inputs; v++ )
+    {
+        Sim = pSims[Abc_ObjFaninId(pObj, v)];
+        for ( m = 0; m < (nMints >> (v+1)); m++ )
+            pMints[m] = (Sim & pMints[2*m+1]) | (~Sim & pMints[2*m]);
+    }
+    return pMints[0];
+}
+void Abc_SclPowerSimRange( Scl_PowThr_t * pThr )
+{
+    Scl_PowMan_t * pMan = pThr->pMan;
+    Abc_Ntk_t * pNtk = pMan->pNtk;
+    Abc_Obj_t * pObj;
+    word Sim, Mask;
+    int i, w, nBits;
+    // the word before the range is simulated without counting to get the first transition right
+    for ( w = Abc_MaxInt(pThr->iWordStart - 1, 0); w < pThr->iWordStop; w++ )
+    {
+        // transitions between the valid patterns of this word (and the last pattern of the previous one)
+        nBits = Abc_MinInt( 64, pMan->nPats - 64 * w );
+        Mask  = nBits == 64 ? ~(word)0 : (((word)1 << nBits) - 1);
+        if ( w == 0 )
+            Mask &= ~(word)1;
+        if ( w < pThr->iWordStart )
+            Mask = 0;
+        pThr->nTrans += Abc_TtCountOnes( Mask );
+        Abc_NtkForEachCi( pNtk, pObj, i )
+        {
+            Sim = pMan->vPats ? Vec_WrdEntry(pMan->vPats, i * pMan->nWords + w) : Abc_SclPowerRandom(i, w);
+            pThr->pToggles[Abc_ObjId(pObj)] += Abc_TtCountOnes( (Sim ^ ((Sim << 1) | (pThr->pSims[Abc_ObjId(pObj)] >> 63))) & Mask );
+            pThr->pSims[Abc_ObjId(pObj)] = Sim;
+        }
+        Abc_NtkForEachNode( pNtk, pObj, i )
+        {
+            Sim = Abc_SclPowerSimNode( pObj, pThr->pSims, pThr->pMints );
+            pThr->pToggles[i] += Abc_TtCountOnes( (Sim ^ ((Sim << 1) | (pThr->pSims[i] >> 63))) & Mask );
+            pThr->pSims[i] = Sim;
+        }
+    }
+}
+#ifdef ABC_USE_PTHREADS
+void * Abc_SclPowerSimWorker( void * pArg )
+{
+    Abc_SclPowerSimRange( (Scl_PowThr_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the number of transitions of each object.]
+
+  Description [Returns the total number of simulated transitions.
+  The simulation words are split evenly among the threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclPowerSimulate( Abc_Ntk_t * pNtk, Vec_Wrd_t * vPats, int nPats, int nThreads, Vec_Int_t * vToggles )
+{
+    Scl_PowThr_t ThData[SCL_POW_THR_MAX];
+    Scl_PowMan_t Man, * pMan = &Man;
+    Abc_Obj_t * pObj;
+    int i, k, nTrans = 0;
+    memset( pMan, 0, sizeof(Scl_PowMan_t) );
+    pMan->pNtk      = pNtk;
+    pMan->vPats     = vPats;
+    pMan->nPats     = nPats;
+    pMan->nWords    = Abc_Bit6WordNum( nPats );
+    pMan->nMintsMax = 1;
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        if ( Abc_SclObjCell(pObj) )
+            pMan->nMintsMax = Abc_MaxInt( pMan->nMintsMax, 1 << Abc_SclObjCell(pObj)->n_inputs );
+    nThreads = Abc_MinInt( Abc_MinInt( Abc_MaxInt(nThreads, 1), SCL_POW_THR_MAX ), pMan->nWords );
+    memset( ThData, 0, sizeof(Scl_PowThr_t) * nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pMan       = pMan;
+        ThData[i].iWordStart = (int)((long)pMan->nWords * i / nThreads);
+        ThData[i].iWordStop  = (int)((long)pMan->nWords * (i+1) / nThreads);
+        ThData[i].pSims      = ABC_CALLOC( word, Abc_NtkObjNumMax(pNtk) );
+        ThData[i].pMints     = ABC_ALLOC( word, pMan->nMintsMax );
+        ThData[i].pToggles   = ABC_CALLOC( int, Abc_NtkObjNumMax(pNtk) );
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[SCL_POW_THR_MAX];
+        int status;
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Abc_SclPowerSimWorker, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        Abc_SclPowerSimRange( ThData );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );    assert( status == 0 );
+        }
+    }
+    else
+#endif
+    {
+        for ( i = 0; i < nThreads; i++ )
+            Abc_SclPowerSimRange( ThData + i );
+    }
+    // merge the results
+    Vec_IntFill( vToggles, Abc_NtkObjNumMax(pNtk), 0 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        for ( k = 0; k < Abc_NtkObjNumMax(pNtk); k++ )
+            Vec_IntAddToEntry( vToggles, k, ThData[i].pToggles[k] );
+        nTrans += ThData[i].nTrans;
+        ABC_FREE( ThData[i].pSims );
+        ABC_FREE( ThData[i].pMints );
+        ABC_FREE( ThData[i].pToggles );
+    }
+    return nTrans;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Estimates the power of the mapped network.]
+
+  Description [The switching power of a net is 1/2*C*V^2*f*a, where C
+  is the load computed by the timing manager, V is the nominal voltage
+  of the library, f is the clock frequency, and a is the toggle rate of
+  the net. The internal power of a gate is E*f*a, where E is the average
+  internal energy of the cell per output transition. The leakage power
+  is the sum of leakages of the cells. If the frequency is not given,
+  it is derived from the delay of the critical path.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclPowerPerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, char * pFileName, int nPats, float Freq, int nThreads, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fVerbose )
+{
+    SC_Man * p;
+    SC_Cell * pCell;
+    Abc_Obj_t * pObj;
+    Vec_Wrd_t * vPats = NULL;
+    Vec_Int_t * vToggles;
+    double Vdd2 = pLib->nom_voltage * pLib->nom_voltage;
+    double Leak = pow( 10.0, 9 - pLib->unit_leak );
+    double Switch = 0, Internal = 0, Leakage = 0, Rate, RateSum = 0, PowS, PowI;
+    abctime clk = Abc_Clock();
+    int i, nTrans, nNets = 0;
+    if ( pFileName && (vPats = Abc_SclPowerReadVectors(pNtk, pFileName, &nPats)) == NULL )
+        return;
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 0, 0, nTreeCRatio, 0 );
+    if ( Freq <= 0 )
+        Freq = 1000000 / Abc_MaxFloat( p->MaxDelay0, 1 ); // MHz
+    vToggles = Vec_IntAlloc( 0 );
+    nTrans = Abc_SclPowerSimulate( pNtk, vPats, nPats, nThreads, vToggles );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Simulation time", Abc_Clock() - clk );
+    // the loads are in ff and the energy is in fJ, which gives power in nW for frequency in MHz
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        if ( !Abc_ObjIsCi(pObj) && !Abc_ObjIsNode(pObj) )
+            continue;
+        pCell = Abc_ObjIsNode(pObj) ? Abc_SclObjCell(pObj) : NULL;
+        Rate  = (double)Vec_IntEntry(vToggles, i) / nTrans;
+        PowS  = 0.5 * Abc_SclObjLoadAve(p, pObj) * Vdd2 * Freq * Rate;
+        PowI  = pCell ? pCell->energy * Freq * Rate : 0;
+        Switch   += PowS;
+        Internal += PowI;
+        Leakage  += pCell ? pCell->leakage * Leak : 0;
+        RateSum  += Rate;
+        nNets++;
+        if ( fShowAll )
+            printf( "%-24s  %-16s  Toggle = %6.4f  Load =%8.2f ff  Switching =%10.3f uW  Internal =%10.3f uW\n",
+                Abc_ObjName(pObj), pCell ? pCell->pName : "(input)", Rate, Abc_SclObjLoadAve(p, pObj), 0.001 * PowS, 0.001 * PowI );
+    }
+    printf( "Patterns = %d.  Freq = %.2f MHz.  Vdd = %.2f V.  Average toggle rate = %.4f.\n", nPats, Freq, pLib->nom_voltage, nNets ? RateSum / nNets : 0 );
+    printf( "Switching = %.3f uW  Internal = %.3f uW  Leakage = %.3f uW  Total = %.3f uW\n",
+        0.001 * Switch, 0.001 * Internal, 0.001 * Leakage, 0.001 * (Switch + Internal + Leakage) );
+    Vec_IntFree( vToggles );
+    Vec_WrdFreeP( &vPats );
+    Abc_SclManFree( p );
+}
+void Abc_SclPowerPerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, char * pFileName, int nPats, float Freq, int nThreads, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fVerbose )
+{
+    Abc_Ntk_t * pNtkNew = pNtk;
+    if ( pNtk->nBarBufs2 > 0 )
+        pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
+    Abc_SclPowerPerformInt( pLib, pNtkNew, pFileName, nPats, Freq, nThreads, nTreeCRatio, fUseWireLoads, fShowAll, fVerbose );
+    if ( pNtk->nBarBufs2 > 0 )
+        Abc_NtkDelete( pNtkNew );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,340 @@
+/**CFile****************************************************************
+
+  FileName    [sclSession.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Persistent incremental timing session driven by text commands.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: sclSession.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Scl_Ses_t_ Scl_Ses_t;
+struct Scl_Ses_t_
+{
+    SC_Man *       p;          // timing manager
+    FILE *         pOut;       // output stream
+    Vec_Int_t *    vJournal;   // uncommitted changes (object ID, previous cell ID)
+    Vec_Int_t *    vMoves;     // uncommitted moves (object ID)
+    Vec_Flt_t *    vMovesXY;   // uncommitted moves (previous coordinates)
+    int            nCommits;   // the number of committed changes
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the object by name.]
+
+  Description [Looks up internal nodes, CIs and COs by name. The name
+  "n<num>" refers to the object with ID <num>. Does not print anything,
+  because the output stream is used by the protocol.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Obj_t * Abc_SclSesFindObj( Abc_Ntk_t * pNtk, char * pName )
+{
+    int Num;
+    if ( pName == NULL )
+        return NULL;
+    Num = Nm_ManFindIdByName( pNtk->pManName, pName, ABC_OBJ_NODE );
+    if ( Num >= 0 )
+        return Abc_NtkObj( pNtk, Num );
+    Num = Nm_ManFindIdByName( pNtk->pManName, pName, ABC_OBJ_PI );
+    if ( Num >= 0 )
+        return Abc_NtkObj( pNtk, Num );
+    Num = Nm_ManFindIdByName( pNtk->pManName, pName, ABC_OBJ_PO );
+    if ( Num >= 0 )
+        return Abc_NtkObj( pNtk, Num );
+    if ( pName[0] != 'n' || pName[1] < '0' || pName[1] > '9' )
+        return NULL;
+    Num = atoi( pName + 1 );
+    if ( Num < 0 || Num >= Abc_NtkObjNumMax(pNtk) )
+        return NULL;
+    return Abc_NtkObj( pNtk, Num );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Changes the cell of one node.]
+
+  Description [Updates the fanin loads and schedules the node for the
+  incremental timing update, which is performed lazily before the next
+  timing query. This way a batch of changes costs one update.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclSesSetCell( Scl_Ses_t * pSes, Abc_Obj_t * pObj, SC_Cell * pCellNew )
+{
+    SC_Man * p = pSes->p;
+    SC_Cell * pCellOld = Abc_SclObjCell( pObj );
+    p->SumArea += pCellNew->area - pCellOld->area;
+    Abc_SclObjSetCell( pObj, pCellNew );
+    Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+    Abc_SclTimeIncInsert( p, pObj );
+}
+static void Abc_SclSesUpdate( Scl_Ses_t * pSes )
+{
+    if ( Vec_IntSize(pSes->p->vChanged) == 0 )
+        return;
+    Abc_SclTimeIncUpdate( pSes->p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reverts the uncommitted changes.]
+
+  Description [Similar to Abc_SclUndoRecentChanges() but restores the
+  cells and the placement of the nodes in the reverse order of the journal.
+  The moves and the resizings are reverted separately because they do not
+  depend on each other.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclSesUndo( Scl_Ses_t * pSes )
+{
+    int i, nChanges = Vec_IntSize(pSes->vJournal) / 2 + Vec_IntSize(pSes->vMoves);
+    for ( i = Vec_IntSize(pSes->vJournal) / 2 - 1; i >= 0; i-- )
+    {
+        Abc_Obj_t * pObj  = Abc_NtkObj( pSes->p->pNtk, Vec_IntEntry(pSes->vJournal, 2*i+0) );
+        SC_Cell * pCell   = SC_LibCell( pSes->p->pLib, Vec_IntEntry(pSes->vJournal, 2*i+1) );
+        Abc_SclSesSetCell( pSes, pObj, pCell );
+    }
+    for ( i = Vec_IntSize(pSes->vMoves) - 1; i >= 0; i-- )
+    {
+        Abc_Obj_t * pObj  = Abc_NtkObj( pSes->p->pNtk, Vec_IntEntry(pSes->vMoves, i) );
+        Abc_SclUpdateLoadPlace( pSes->p, pObj, Vec_FltEntry(pSes->vMovesXY, 2*i+0), Vec_FltEntry(pSes->vMovesXY, 2*i+1) );
+    }
+    Vec_IntClear( pSes->vJournal );
+    Vec_IntClear( pSes->vMoves );
+    Vec_FltClear( pSes->vMovesXY );
+    return nChanges;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes one command of the session.]
+
+  Description [Returns 0 when the session is over. Each command produces
+  exactly one line of output, which starts with "ok" or "error".]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclSesCommand( Scl_Ses_t * pSes, char * pLine )
+{
+    SC_Man * p = pSes->p;
+    char * pCmd  = strtok( pLine, " \t\r\n" );
+    char * pArg1 = pCmd ? strtok( NULL, " \t\r\n" ) : NULL;
+    char * pArg2 = pArg1 ? strtok( NULL, " \t\r\n" ) : NULL;
+    Abc_Obj_t * pObj;
+    SC_Cell * pCell;
+    int iCell;
+    if ( pCmd == NULL || pCmd[0] == '#' )
+        return 1;
+    if ( !strcmp(pCmd, "quit") )
+    {
+        fprintf( pSes->pOut, "ok %d\n", Abc_SclSesUndo(pSes) );
+        return 0;
+    }
+    if ( !strcmp(pCmd, "commit") )
+    {
+        int nChanges = Vec_IntSize(pSes->vJournal) / 2 + Vec_IntSize(pSes->vMoves);
+        pSes->nCommits += nChanges;
+        fprintf( pSes->pOut, "ok %d\n", nChanges );
+        Vec_IntClear( pSes->vJournal );
+        Vec_IntClear( pSes->vMoves );
+        Vec_FltClear( pSes->vMovesXY );
+        return 1;
+    }
+    if ( !strcmp(pCmd, "undo") )
+    {
+        fprintf( pSes->pOut, "ok %d\n", Abc_SclSesUndo(pSes) );
+        return 1;
+    }
+    if ( !strcmp(pCmd, "delay") )
+    {
+        Abc_SclSesUpdate( pSes );
+        fprintf( pSes->pOut, "ok %.2f %.2f\n", p->MaxDelay, p->SumArea );
+        return 1;
+    }
+    if ( strcmp(pCmd, "size") && strcmp(pCmd, "move") && strcmp(pCmd, "cell") && strcmp(pCmd, "arrival") && strcmp(pCmd, "slack") )
+    {
+        fprintf( pSes->pOut, "error unknown command \"%s\"\n", pCmd );
+        return 1;
+    }
+    pObj = Abc_SclSesFindObj( p->pNtk, pArg1 );
+    if ( pObj == NULL )
+    {
+        fprintf( pSes->pOut, "error cannot find object \"%s\"\n", pArg1 ? pArg1 : "" );
+        return 1;
+    }
+    if ( !strcmp(pCmd, "arrival") )
+    {
+        Abc_SclSesUpdate( pSes );
+        fprintf( pSes->pOut, "ok %.2f %.2f\n", Abc_SclObjTime(p, pObj)->rise, Abc_SclObjTime(p, pObj)->fall );
+        return 1;
+    }
+    if ( !strcmp(pCmd, "slack") )
+    {
+        Abc_SclSesUpdate( pSes );
+        fprintf( pSes->pOut, "ok %.2f\n", Abc_SclObjGetSlack(p, pObj, p->MaxDelay) );
+        return 1;
+    }
+    if ( !strcmp(pCmd, "move") )
+    {
+        char * pArg3 = pArg2 ? strtok( NULL, " \t\r\n" ) : NULL;
+        if ( p->vPlace == NULL )
+        {
+            fprintf( pSes->pOut, "error the network is not placed\n" );
+            return 1;
+        }
+        if ( pArg3 == NULL )
+        {
+            fprintf( pSes->pOut, "error missing coordinates\n" );
+            return 1;
+        }
+        Vec_FltFillExtra( p->vPlace, 2 * Abc_NtkObjNumMax(p->pNtk), ABC_INFINITY );
+        Vec_IntPush( pSes->vMoves, Abc_ObjId(pObj) );
+        Vec_FltPush( pSes->vMovesXY, Vec_FltEntry(p->vPlace, 2*Abc_ObjId(pObj)+0) );
+        Vec_FltPush( pSes->vMovesXY, Vec_FltEntry(p->vPlace, 2*Abc_ObjId(pObj)+1) );
+        Abc_SclUpdateLoadPlace( p, pObj, (float)atof(pArg2), (float)atof(pArg3) );
+        fprintf( pSes->pOut, "ok\n" );
+        return 1;
+    }
+    if ( !Abc_ObjIsNode(pObj) || Abc_ObjFaninNum(pObj) == 0 )
+    {
+        fprintf( pSes->pOut, "error object \"%s\" is not a gate\n", pArg1 );
+        return 1;
+    }
+    if ( !strcmp(pCmd, "cell") )
+    {
+        fprintf( pSes->pOut, "ok %s\n", Abc_SclObjCell(pObj)->pName );
+        return 1;
+    }
+    // resize the gate
+    iCell = pArg2 ? Abc_SclCellFind( p->pLib, pArg2 ) : -1;
+    if ( iCell == -1 )
+    {
+        fprintf( pSes->pOut, "error cannot find cell \"%s\"\n", pArg2 ? pArg2 : "" );
+        return 1;
+    }
+    pCell = SC_LibCell( p->pLib, iCell );
+    if ( pCell->pRepr != Abc_SclObjCell(pObj)->pRepr )
+    {
+        fprintf( pSes->pOut, "error cell \"%s\" is not a size of cell \"%s\"\n", pCell->pName, Abc_SclObjCell(pObj)->pName );
+        return 1;
+    }
+    if ( pCell != Abc_SclObjCell(pObj) )
+    {
+        Vec_IntPush( pSes->vJournal, Abc_ObjId(pObj) );
+        Vec_IntPush( pSes->vJournal, Abc_SclObjCellId(pObj) );
+        Abc_SclSesSetCell( pSes, pObj, pCell );
+    }
+    fprintf( pSes->pOut, "ok\n" );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the timing session.]
+
+  Description [The timing manager is started once and kept until the end
+  of the session, so an external optimizer can try many gate sizes without
+  reloading the network. Commands are read line by line from pIn:
+    size <obj> <cell>  - changes the cell of the gate (same functional class)
+    move <obj> <x> <y> - changes the placement of the object (see read_place)
+    cell <obj>         - returns the current cell of the gate
+    arrival <obj>      - returns the rise/fall arrival times
+    slack <obj>        - returns the slack w.r.t. the current max delay
+    delay              - returns the max delay and the total area
+    commit             - accepts all changes since the last commit/undo
+    undo               - reverts all changes since the last commit/undo
+    quit               - reverts uncommitted changes and ends the session
+  The timing is updated incrementally before the first query following
+  a batch of changes. The answers are flushed after each command. When
+  the session is over, the committed cells are transferred to the network.
+  The verbose summary is printed into pErr.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclSessionPerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, FILE * pIn, FILE * pOut, FILE * pErr, int nTreeCRatio, int fUseWireLoads, int fVerbose )
+{
+    Scl_Ses_t Ses, * pSes = &Ses;
+    char * pBuffer = ABC_ALLOC( char, 10000 );
+    int nCommands = 0;
+    abctime clk = Abc_Clock();
+    memset( pSes, 0, sizeof(Scl_Ses_t) );
+    pSes->p        = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, 0 );
+    pSes->pOut     = pOut;
+    pSes->vJournal = Vec_IntAlloc( 100 );
+    pSes->vMoves   = Vec_IntAlloc( 100 );
+    pSes->vMovesXY = Vec_FltAlloc( 100 );
+    fprintf( pOut, "ok %.2f %.2f\n", pSes->p->MaxDelay, pSes->p->SumArea );
+    fflush( pOut );
+    while ( fgets( pBuffer, 10000, pIn ) != NULL )
+    {
+        int RetValue = Abc_SclSesCommand( pSes, pBuffer );
+        fflush( pOut );
+        nCommands++;
+        if ( RetValue == 0 )
+            break;
+    }
+    // the input may end without "quit"
+    Abc_SclSesUndo( pSes );
+    if ( fVerbose )
+    {
+        Abc_SclSesUpdate( pSes );
+        // the summary goes to the error stream to keep the answers on pOut parsable
+        fprintf( pErr, "Session processed %d commands and committed %d changes.  Delay = %.2f ps.  Area = %.2f.  ",
+            nCommands, pSes->nCommits, pSes->p->MaxDelay, pSes->p->SumArea );
+        fprintf( pErr, "%s =%9.2f sec\n", "Time", 1.0*((double)(Abc_Clock() - clk))/((double)CLOCKS_PER_SEC) );
+    }
+    Abc_SclSclGates2MioGates( pLib, pNtk );
+    Abc_SclManFree( pSes->p );
+    Vec_IntFree( pSes->vJournal );
+    Vec_IntFree( pSes->vMoves );
+    Vec_FltFree( pSes->vMovesXY );
+    ABC_FREE( pBuffer );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -281,6 +281,11 @@ static inline void Abc_SclDeptObj( SC_Man * p, Abc_Obj_t * pObj )
     SC_Timing * pTime;
     Abc_Obj_t * pFanout;
     int i;
+    if ( p->nCorners )
+    {
+        Abc_SclDeptObjCorners( p, pObj );
+        return;
+    }
     SC_PairClean( Abc_SclObjDept(p, pObj) );
     Abc_ObjForEachFanout( pObj, pFanout, i )
     {
@@ -290,11 +295,6 @@ static inline void Abc_SclDeptObj( SC_Man * p, Abc_Obj_t * pObj )
         Abc_SclDeptFanin( p, pTime, pFanout, pObj );
     }
 }
-static inline float Abc_SclObjLoadValue( SC_Man * p, Abc_Obj_t * pObj )
-{
-//    float Value = Abc_MaxFloat(pLoad->fall, pLoad->rise) / (p->EstLoadAve * p->EstLoadMax);
-    return (0.5 * Abc_SclObjLoad(p, pObj)->fall + 0.5 * Abc_SclObjLoad(p, pObj)->rise) / (p->EstLoadAve * p->EstLoadMax);
-}
 static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
 {
     if ( p->pPiDrive != NULL )
@@ -305,7 +305,7 @@ static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
         Scl_LibHandleInputDriver( p->pPiDrive, pLoad, pTime, pSlew );
     }
 }
-void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+void Abc_SclTimeNodeInt( SC_Man * p, Abc_Obj_t * pObj, int fDept, int * pnEstNodes )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
@@ -317,6 +317,11 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
     float DeptFall = 0;
     float Value = p->EstLoadMax ? Abc_SclObjLoadValue( p, pObj ) : 0;
     Abc_Obj_t * pFanin;
+    if ( p->nCorners )
+    {
+        Abc_SclTimeNodeCorners( p, pObj, fDept, pnEstNodes );
+        return;
+    }
     if ( Abc_ObjIsCi(pObj) )
     {
         assert( !fDept );
@@ -348,7 +353,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pDepOut->rise += EstDelta;
             pDepOut->fall += EstDelta;
         }
-        p->nEstNodes++;
+        (*pnEstNodes)++;
     }
     // get the library cell
     pCell = Abc_SclObjCell( pObj );
@@ -380,6 +385,10 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         }
     }
 }
+void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    Abc_SclTimeNodeInt( p, pObj, fDept, &p->nEstNodes );
+}
 void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
 {
     int fVerbose = 0;
@@ -407,6 +416,9 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->nThreads > 1 )
+        Abc_SclTimeNtkLevels( p, 0 );
+    else
     Abc_NtkForEachNode1( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     Abc_NtkForEachCo( p->pNtk, pObj, i )
@@ -421,6 +433,9 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     if ( fReverse )
     {
         p->nEstNodes = 0;
+        if ( p->nThreads > 1 )
+            Abc_SclTimeNtkLevels( p, 1 );
+        else
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
             Abc_SclTimeNode( p, pObj, 1 );
     }
@@ -491,9 +506,8 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
         {
             if ( Abc_ObjIsCo(pObj) )
             {
-                Abc_SclObjDupFanin( p, pObj );
-                Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
-                Vec_QueUpdate( p->vQue, pObj->iData );
+                // also copies the timing of each corner
+                Abc_SclTimeNode( p, pObj, 0 );
                 continue;
             }
             pArrOut  = Abc_SclObjTime( p, pObj );
@@ -630,9 +644,10 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nThreads )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nThreads = nThreads;
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -640,6 +655,7 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
     }
     Abc_SclMioGates2SclGates( pLib, pNtk );
     Abc_SclManReadSlewAndLoad( p, pNtk );
+    Abc_SclManStartCorners( p );
     if ( fUseWireLoads )
     {
         if ( pNtk->pWLoadUsed == NULL )
@@ -668,11 +684,13 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nThreads );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
+    if ( p->nCorners )
+        Abc_SclTimeCornersPrint( p );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
     Abc_SclManFree( p );
@@ -689,12 +707,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nThreads );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -899,7 +917,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 0 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
@@ -54,6 +54,9 @@ struct SC_Man_
     // timing information
     SC_WireLoad *  pWLoadUsed;    // name of the used WireLoad model
     Vec_Flt_t *    vWireCaps;     // wire capacitances
+    Vec_Flt_t *    vPlace;        // placement coordinates of the objects (owned by the network)
+    Vec_Flt_t *    vPlaceLoads;   // wire capacitance of each net computed from placement
+    float          PlaceCap;      // wire capacitance per unit of placement distance
     SC_Pair *      pLoads;        // loads for each gate
     SC_Pair *      pDepts;        // departures for each gate
     SC_Pair *      pTimes;        // arrivals for each gate
@@ -72,6 +75,14 @@ struct SC_Man_
     float          EstLoadAve;    // average load of the gate
     float          EstLinear;     // linear coefficient
     int            nEstNodes;     // the number of estimations
+    int            nThreads;      // the number of threads for timing
+    // timing corners
+    int            nCorners;      // the number of corners (0 if only one library is used)
+    SC_Cell **     pCornerCells;  // the cell of each corner for each cell of the library
+    SC_Cell **     pCornerDrive;  // the cell driving primary inputs in each corner
+    SC_Pair *      pCornerTimes;  // arrivals for each gate and corner
+    SC_Pair *      pCornerSlews;  // slews for each gate and corner
+    SC_Pair *      pCornerDepts;  // departures for each gate and corner
     // intermediate data
     Vec_Que_t *    vNodeByGain;   // nodes by gain
     Vec_Flt_t *    vNode2Gain;    // mapping node into its gain
@@ -115,6 +126,15 @@ static inline SC_Pair * Abc_SclObjDept( SC_Man * p, Abc_Obj_t * pObj )
 static inline SC_Pair * Abc_SclObjTime( SC_Man * p, Abc_Obj_t * pObj )              { return p->pTimes + Abc_ObjId(pObj);  }
 static inline SC_Pair * Abc_SclObjSlew( SC_Man * p, Abc_Obj_t * pObj )              { return p->pSlews + Abc_ObjId(pObj);  }
 
+static inline int       Abc_SclObjIsPlaced( SC_Man * p, Abc_Obj_t * pObj )           { return 2*Abc_ObjId(pObj)+1 < Vec_FltSize(p->vPlace) && Vec_FltEntry(p->vPlace, 2*Abc_ObjId(pObj)) != ABC_INFINITY; }
+static inline float     Abc_SclObjPlaceX( SC_Man * p, Abc_Obj_t * pObj )            { return Vec_FltEntry( p->vPlace, 2*Abc_ObjId(pObj)+0 );                              }
+static inline float     Abc_SclObjPlaceY( SC_Man * p, Abc_Obj_t * pObj )            { return Vec_FltEntry( p->vPlace, 2*Abc_ObjId(pObj)+1 );                              }
+
+static inline SC_Pair * Abc_SclObjTimeC( SC_Man * p, Abc_Obj_t * pObj, int c )     { return p->pCornerTimes + Abc_ObjId(pObj) * p->nCorners + c;  }
+static inline SC_Pair * Abc_SclObjSlewC( SC_Man * p, Abc_Obj_t * pObj, int c )     { return p->pCornerSlews + Abc_ObjId(pObj) * p->nCorners + c;  }
+static inline SC_Pair * Abc_SclObjDeptC( SC_Man * p, Abc_Obj_t * pObj, int c )     { return p->pCornerDepts + Abc_ObjId(pObj) * p->nCorners + c;  }
+static inline SC_Cell * Abc_SclCellCorner( SC_Man * p, SC_Cell * pCell, int c )    { return p->pCornerCells[pCell->Id * p->nCorners + c];          }
+
 static inline double    Abc_SclObjLoadMax( SC_Man * p, Abc_Obj_t * pObj )           { return Abc_MaxFloat(Abc_SclObjLoad(p, pObj)->rise, Abc_SclObjLoad(p, pObj)->fall);  }
 static inline float     Abc_SclObjLoadAve( SC_Man * p, Abc_Obj_t * pObj )           { return 0.5 * Abc_SclObjLoad(p, pObj)->rise + 0.5 * Abc_SclObjLoad(p, pObj)->fall;   }
 static inline double    Abc_SclObjTimeOne( SC_Man * p, Abc_Obj_t * pObj, int fRise ){ return fRise ? Abc_SclObjTime(p, pObj)->rise : Abc_SclObjTime(p, pObj)->fall;       }
@@ -160,6 +180,8 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->pDepts    = ABC_CALLOC( SC_Pair, p->nObjs );
     p->pTimes    = ABC_CALLOC( SC_Pair, p->nObjs );
     p->pSlews    = ABC_CALLOC( SC_Pair, p->nObjs );
+    p->vPlace    = pNtk->vPlace;
+    p->PlaceCap  = pNtk->PlaceCap;
     p->vBestFans = Vec_IntStart( p->nObjs );
     p->vTimesOut = Vec_FltStart( Abc_NtkCoNum(pNtk) );
     p->vQue      = Vec_QueAlloc( Abc_NtkCoNum(pNtk) );
@@ -222,12 +244,50 @@ static inline void Abc_SclManFree( SC_Man * p )
     Vec_IntFreeP( &p->vBestFans );
     Vec_FltFreeP( &p->vInDrive );
     Vec_FltFreeP( &p->vWireCaps );
+    Vec_FltFreeP( &p->vPlaceLoads );
     ABC_FREE( p->pLoads );
     ABC_FREE( p->pDepts );
     ABC_FREE( p->pTimes );
     ABC_FREE( p->pSlews );
+    ABC_FREE( p->pCornerCells );
+    ABC_FREE( p->pCornerDrive );
+    ABC_FREE( p->pCornerTimes );
+    ABC_FREE( p->pCornerSlews );
+    ABC_FREE( p->pCornerDepts );
     ABC_FREE( p );
 }
+static inline void Abc_SclManGrow( SC_Man * p, int nObjs )
+{
+    if ( nObjs <= p->nObjs )
+        return;
+    nObjs = Abc_MaxInt( nObjs, 2 * p->nObjs );
+    p->pLoads = ABC_REALLOC( SC_Pair, p->pLoads, nObjs );
+    p->pDepts = ABC_REALLOC( SC_Pair, p->pDepts, nObjs );
+    p->pTimes = ABC_REALLOC( SC_Pair, p->pTimes, nObjs );
+    p->pSlews = ABC_REALLOC( SC_Pair, p->pSlews, nObjs );
+    memset( p->pLoads + p->nObjs, 0, sizeof(SC_Pair) * (nObjs - p->nObjs) );
+    memset( p->pDepts + p->nObjs, 0, sizeof(SC_Pair) * (nObjs - p->nObjs) );
+    memset( p->pTimes + p->nObjs, 0, sizeof(SC_Pair) * (nObjs - p->nObjs) );
+    memset( p->pSlews + p->nObjs, 0, sizeof(SC_Pair) * (nObjs - p->nObjs) );
+    if ( p->nCorners )
+    {
+        int nOld = p->nObjs * p->nCorners, nNew = nObjs * p->nCorners;
+        p->pCornerTimes = ABC_REALLOC( SC_Pair, p->pCornerTimes, nNew );
+        p->pCornerSlews = ABC_REALLOC( SC_Pair, p->pCornerSlews, nNew );
+        p->pCornerDepts = ABC_REALLOC( SC_Pair, p->pCornerDepts, nNew );
+        memset( p->pCornerTimes + nOld, 0, sizeof(SC_Pair) * (nNew - nOld) );
+        memset( p->pCornerSlews + nOld, 0, sizeof(SC_Pair) * (nNew - nOld) );
+        memset( p->pCornerDepts + nOld, 0, sizeof(SC_Pair) * (nNew - nOld) );
+    }
+    if ( p->vPlaceLoads )
+        Vec_FltFillExtra( p->vPlaceLoads, nObjs, 0 );
+    Vec_IntFillExtra( p->vBestFans, nObjs, 0 );
+    Vec_FltFillExtra( p->vNode2Gain, nObjs, 0 );
+    Vec_IntFillExtra( p->vNode2Gate, nObjs, 0 );
+    Vec_IntFillExtra( p->vNodeIter, nObjs, -1 );
+    Vec_QueGrow( p->vNodeByGain, nObjs );
+    p->nObjs = nObjs;
+}
 /*
 static inline void Abc_SclManCleanTime( SC_Man * p )
 {
@@ -253,11 +313,22 @@ static inline void Abc_SclManCleanTime( SC_Man * p )
     Vec_FltFree( vSlews );
 }
 */
+static inline float Abc_SclObjLoadValue( SC_Man * p, Abc_Obj_t * pObj )
+{
+//    float Value = Abc_MaxFloat(pLoad->fall, pLoad->rise) / (p->EstLoadAve * p->EstLoadMax);
+    return (0.5 * Abc_SclObjLoad(p, pObj)->fall + 0.5 * Abc_SclObjLoad(p, pObj)->rise) / (p->EstLoadAve * p->EstLoadMax);
+}
 static inline void Abc_SclManCleanTime( SC_Man * p )
 {
     memset( p->pTimes, 0, sizeof(SC_Pair) * p->nObjs );
     memset( p->pSlews, 0, sizeof(SC_Pair) * p->nObjs );
     memset( p->pDepts, 0, sizeof(SC_Pair) * p->nObjs );
+    if ( p->nCorners )
+    {
+        memset( p->pCornerTimes, 0, sizeof(SC_Pair) * p->nObjs * p->nCorners );
+        memset( p->pCornerSlews, 0, sizeof(SC_Pair) * p->nObjs * p->nCorners );
+        memset( p->pCornerDepts, 0, sizeof(SC_Pair) * p->nObjs * p->nCorners );
+    }
 /*
     if ( p->pPiDrive != NULL )
     {
@@ -339,7 +410,7 @@ static inline void Abc_SclLoadRestore3( SC_Man * p, Abc_Obj_t * pObj )
 static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
-    int i;
+    int i, c;
     Vec_FltClear( p->vTimes2 );
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
@@ -347,18 +418,32 @@ static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
         Vec_FltPush( p->vTimes2, Abc_SclObjTime(p, pObj)->fall );
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->rise );
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->fall );
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Vec_FltPush( p->vTimes2, Abc_SclObjTimeC(p, pObj, c)->rise );
+            Vec_FltPush( p->vTimes2, Abc_SclObjTimeC(p, pObj, c)->fall );
+            Vec_FltPush( p->vTimes2, Abc_SclObjSlewC(p, pObj, c)->rise );
+            Vec_FltPush( p->vTimes2, Abc_SclObjSlewC(p, pObj, c)->fall );
+        }
     }
 }
 static inline void Abc_SclConeRestore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
-    int i, k = 0;
+    int i, c, k = 0;
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
         Abc_SclObjTime(p, pObj)->rise = Vec_FltEntry(p->vTimes2, k++);
         Abc_SclObjTime(p, pObj)->fall = Vec_FltEntry(p->vTimes2, k++);
         Abc_SclObjSlew(p, pObj)->rise = Vec_FltEntry(p->vTimes2, k++);
         Abc_SclObjSlew(p, pObj)->fall = Vec_FltEntry(p->vTimes2, k++);
+        for ( c = 0; c < p->nCorners; c++ )
+        {
+            Abc_SclObjTimeC(p, pObj, c)->rise = Vec_FltEntry(p->vTimes2, k++);
+            Abc_SclObjTimeC(p, pObj, c)->fall = Vec_FltEntry(p->vTimes2, k++);
+            Abc_SclObjSlewC(p, pObj, c)->rise = Vec_FltEntry(p->vTimes2, k++);
+            Abc_SclObjSlewC(p, pObj, c)->fall = Vec_FltEntry(p->vTimes2, k++);
+        }
     }
     assert( Vec_FltSize(p->vTimes2) == k );
 }
@@ -539,6 +624,8 @@ static inline void Abc_SclDumpStats( SC_Man * p, char * pFileName, abctime Time
 
 /*=== sclBuffer.c ===============================================================*/
 extern Abc_Ntk_t *   Abc_SclBufferingPerform( Abc_Ntk_t * pNtk, SC_Lib * pLib, SC_BusPars * pPars );
+/*=== sclBufTree.c ===============================================================*/
+extern Abc_Ntk_t *   Abc_SclBufTreePerform( Abc_Ntk_t * pNtk, SC_Lib * pLib, SC_BusPars * pPars );
 /*=== sclBufferOld.c ===============================================================*/
 extern int           Abc_SclIsInv( Abc_Obj_t * pObj );
 extern void          Abc_NodeInvUpdateFanPolarity( Abc_Obj_t * pObj );
@@ -550,30 +637,52 @@ extern Abc_Ntk_t *   Abc_SclBufferPhase( Abc_Ntk_t * pNtk, int fVerbose );
 extern int           Abc_SclCheckNtk( Abc_Ntk_t * p, int fVerbose );
 extern Abc_Ntk_t *   Abc_SclPerformBuffering( Abc_Ntk_t * p, int DegreeR, int Degree, int fUseInvs, int fVerbose );
 extern Abc_Ntk_t *   Abc_SclBufPerform( Abc_Ntk_t * pNtk, int FanMin, int FanMax, int fBufPis, int fSkipDup, int fVerbose );
+/*=== sclCorner.c ===============================================================*/
+extern void          Abc_SclManStartCorners( SC_Man * p );
+extern void          Abc_SclTimeNodeCorners( SC_Man * p, Abc_Obj_t * pObj, int fDept, int * pnEstNodes );
+extern void          Abc_SclDeptObjCorners( SC_Man * p, Abc_Obj_t * pObj );
+extern void          Abc_SclTimeCornersPrint( SC_Man * p );
 /*=== sclDnsize.c ===============================================================*/
+extern void          Abc_SclFindWindow( Abc_Obj_t * pPivot, Vec_Int_t ** pvNodes, Vec_Int_t ** pvEvals );
 extern void          Abc_SclDnsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars );
 /*=== sclLoad.c ===============================================================*/
 extern Vec_Flt_t *   Abc_SclFindWireCaps( SC_WireLoad * pWL, int nFanoutMax );
 extern float         Abc_SclFindWireLoad( Vec_Flt_t * vWireCaps, int nFans );
 extern void          Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubtr );
+extern float         Abc_SclFindPlaceLoad( SC_Man * p, Abc_Obj_t * pObj );
+extern void          Abc_SclAddPlaceLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubtr );
 extern void          Abc_SclComputeLoad( SC_Man * p );
 extern void          Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew );
+extern void          Abc_SclUpdateLoadPlace( SC_Man * p, Abc_Obj_t * pObj, float X, float Y );
 extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout );
+/*=== sclPlace.c ===============================================================*/
+extern int           Abc_SclReadPlacement( Abc_Ntk_t * pNtk, char * pFileName, float PlaceCap, int fVerbose );
+/*=== sclPower.c ===============================================================*/
+extern Vec_Wrd_t *   Abc_SclPowerReadVectors( Abc_Ntk_t * pNtk, char * pFileName, int * pnPats );
+extern int           Abc_SclPowerSimulate( Abc_Ntk_t * pNtk, Vec_Wrd_t * vPats, int nPats, int nThreads, Vec_Int_t * vToggles );
+extern void          Abc_SclPowerPerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, char * pFileName, int nPats, float Freq, int nThreads, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fVerbose );
+/*=== sclSession.c ===============================================================*/
+extern void          Abc_SclSessionPerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, FILE * pIn, FILE * pOut, FILE * pErr, int nTreeCRatio, int fUseWireLoads, int fVerbose );
 /*=== sclSize.c ===============================================================*/
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nThreads );
+extern void          Abc_SclTimeNodeInt( SC_Man * p, Abc_Obj_t * pObj, int fDept, int * pnEstNodes );
+extern void          Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
-extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads );
+/*=== sclTimePar.c ===============================================================*/
+extern void          Abc_SclTimeNtkLevels( SC_Man * p, int fDept );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
 extern void          Abc_SclUpsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars );
+extern void          Abc_SclFindBestCellsParInt( SC_Man * p, Vec_Int_t * vCands, Vec_Wec_t * vRecalcs, Vec_Wec_t * vEvals, Vec_Int_t * vGates, Vec_Flt_t * vGains, int Notches, int DelayGap, int fDnsize );
 /*=== sclUtil.c ===============================================================*/
 extern void          Abc_SclMioGates2SclGates( SC_Lib * pLib, Abc_Ntk_t * p );
 extern void          Abc_SclSclGates2MioGates( SC_Lib * pLib, Abc_Ntk_t * p );
@@ -0,0 +1,340 @@
+/**CFile****************************************************************
+
+  FileName    [sclTimePar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Level-parallel static timing analysis.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: sclTimePar.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SCL_PAR_THR_MAX  64     // the largest number of threads
+#define SCL_PAR_LEV_MIN  256    // the smallest level processed concurrently
+
+typedef struct Scl_ParMan_t_ Scl_ParMan_t;
+struct Scl_ParMan_t_
+{
+    SC_Man *         p;             // the timing manager
+    int              fDept;         // computing departures
+    int              nThreads;      // the number of threads
+    Vec_Int_t *      vStarts;       // the first entry of each level in vObjs
+    Vec_Int_t *      vObjs;         // object IDs sorted by level
+    int              nEstNodes[SCL_PAR_THR_MAX]; // estimations of each thread
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;         // protects the fields below
+    pthread_cond_t   CondStart;     // signals the workers to start
+    pthread_cond_t   CondDone;      // signals the master that the level is done
+    int              iLevel;        // the level being processed
+    int              iRound;        // incremented when a new level is started
+    int              nDone;         // the number of workers done with the level
+    int              fStop;         // stops the workers
+#endif
+};
+
+typedef struct Scl_ParThr_t_ Scl_ParThr_t;
+struct Scl_ParThr_t_
+{
+    Scl_ParMan_t *   pMan;          // the shared data
+    int              iThread;       // the thread number
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Buckets the objects of the network by level.]
+
+  Description [Levels are computed in the topological order of object IDs
+  assumed by the serial engine. When arrivals are computed, the buckets
+  contain internal nodes with fanins. When departures are computed, the
+  buckets also contain CIs and constant nodes, whose departures are
+  derived from their fanouts.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeParLevels( Scl_ParMan_t * pMan )
+{
+    Abc_Ntk_t * pNtk = pMan->p->pNtk;
+    Vec_Int_t * vLevels = Vec_IntStart( Abc_NtkObjNumMax(pNtk) );
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level, LevelMax = 0;
+    Abc_NtkForEachNode1( pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Abc_ObjId(pFanin)) );
+        Vec_IntWriteEntry( vLevels, i, Level + 1 );
+        LevelMax = Abc_MaxInt( LevelMax, Level + 1 );
+    }
+    // count objects in each level
+    pMan->vStarts = Vec_IntStart( LevelMax + 2 );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( Abc_ObjIsNode(pObj) ? (pMan->fDept || Abc_ObjFaninNum(pObj) > 0) : (pMan->fDept && Abc_ObjIsCi(pObj)) )
+            Vec_IntAddToEntry( pMan->vStarts, Vec_IntEntry(vLevels, i) + 1, 1 );
+    for ( Level = 1; Level < Vec_IntSize(pMan->vStarts); Level++ )
+        Vec_IntAddToEntry( pMan->vStarts, Level, Vec_IntEntry(pMan->vStarts, Level - 1) );
+    // place objects into their levels
+    pMan->vObjs = Vec_IntStart( Vec_IntEntryLast(pMan->vStarts) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( Abc_ObjIsNode(pObj) ? (pMan->fDept || Abc_ObjFaninNum(pObj) > 0) : (pMan->fDept && Abc_ObjIsCi(pObj)) )
+        {
+            int * pPlace = Vec_IntEntryP( pMan->vStarts, Vec_IntEntry(vLevels, i) );
+            Vec_IntWriteEntry( pMan->vObjs, (*pPlace)++, i );
+        }
+    // restore the starts
+    for ( Level = Vec_IntSize(pMan->vStarts) - 1; Level > 0; Level-- )
+        Vec_IntWriteEntry( pMan->vStarts, Level, Vec_IntEntry(pMan->vStarts, Level - 1) );
+    Vec_IntWriteEntry( pMan->vStarts, 0, 0 );
+    Vec_IntFree( vLevels );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes departure of one object from its fanouts.]
+
+  Description [The serial engine pushes the departure of each node into
+  its fanins, which cannot be done concurrently because fanins are shared.
+  Here the same values are pulled by the fanin from its fanouts. The loads
+  and departures of the fanouts adjusted for the buffer tree estimation
+  are kept in local copies, so that the fanouts are not modified.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclDeptObjPull( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes )
+{
+    SC_Pair * pDepIn  = Abc_SclObjDept( p, pObj );
+    SC_Pair * pSlewIn = Abc_SclObjSlew( p, pObj );
+    SC_Pair Load, Dept;
+    Abc_Obj_t * pFanout, * pFanin;
+    SC_Cell * pCell;
+    float Value;
+    int i, k;
+    if ( p->EstLoadMax && Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0 && Abc_SclObjLoadValue(p, pObj) > 1 )
+        (*pnEstNodes)++;
+    if ( p->nCorners )
+    {
+        Abc_SclDeptObjCorners( p, pObj );
+        return;
+    }
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_ObjIsNode(pFanout) )
+            continue;
+        Load  = *Abc_SclObjLoad( p, pFanout );
+        Dept  = *Abc_SclObjDept( p, pFanout );
+        Value = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        if ( p->EstLoadMax && Value > 1 )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load.rise = p->EstLoadAve * p->EstLoadMax;
+            Load.fall = p->EstLoadAve * p->EstLoadMax;
+            Dept.rise += EstDelta;
+            Dept.fall += EstDelta;
+        }
+        pCell = Abc_SclObjCell( pFanout );
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+                Scl_LibPinDeparture( Scl_CellPinTime(pCell, k), pDepIn, pSlewIn, &Load, &Dept );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes a slice of one level.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeParRange( Scl_ParMan_t * pMan, int iLevel, int iThread, int nThreads )
+{
+    SC_Man * p = pMan->p;
+    int iStart = Vec_IntEntry( pMan->vStarts, iLevel );
+    int nObjs  = Vec_IntEntry( pMan->vStarts, iLevel + 1 ) - iStart;
+    int iBeg   = iStart + (int)((word)nObjs * iThread / nThreads);
+    int iEnd   = iStart + (int)((word)nObjs * (iThread + 1) / nThreads);
+    int i;
+    for ( i = iBeg; i < iEnd; i++ )
+    {
+        Abc_Obj_t * pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(pMan->vObjs, i) );
+        if ( pMan->fDept )
+            Abc_SclDeptObjPull( p, pObj, &pMan->nEstNodes[iThread] );
+        else
+            Abc_SclTimeNodeInt( p, pObj, 0, &pMan->nEstNodes[iThread] );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description [Waits until the master starts a new level, processes its
+  own slice of this level and reports back.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+void * Abc_SclTimeParWorker( void * pArg )
+{
+    Scl_ParThr_t * pThData = (Scl_ParThr_t *)pArg;
+    Scl_ParMan_t * pMan = pThData->pMan;
+    int iRound = 0, iLevel;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pMan->Mutex );
+        while ( pMan->iRound == iRound && !pMan->fStop )
+            pthread_cond_wait( &pMan->CondStart, &pMan->Mutex );
+        if ( pMan->fStop )
+        {
+            pthread_mutex_unlock( &pMan->Mutex );
+            break;
+        }
+        iRound = pMan->iRound;
+        iLevel = pMan->iLevel;
+        pthread_mutex_unlock( &pMan->Mutex );
+        Abc_SclTimeParRange( pMan, iLevel, pThData->iThread, pMan->nThreads );
+        pthread_mutex_lock( &pMan->Mutex );
+        if ( ++pMan->nDone == pMan->nThreads - 1 )
+            pthread_cond_signal( &pMan->CondDone );
+        pthread_mutex_unlock( &pMan->Mutex );
+    }
+    pthread_exit( NULL );
+    return NULL;
+}
+void Abc_SclTimeParLevel( Scl_ParMan_t * pMan, int iLevel )
+{
+    pthread_mutex_lock( &pMan->Mutex );
+    pMan->iLevel = iLevel;
+    pMan->nDone  = 0;
+    pMan->iRound++;
+    pthread_cond_broadcast( &pMan->CondStart );
+    pthread_mutex_unlock( &pMan->Mutex );
+    Abc_SclTimeParRange( pMan, iLevel, 0, pMan->nThreads );
+    pthread_mutex_lock( &pMan->Mutex );
+    while ( pMan->nDone < pMan->nThreads - 1 )
+        pthread_cond_wait( &pMan->CondDone, &pMan->Mutex );
+    pthread_mutex_unlock( &pMan->Mutex );
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrivals or departures of the nodes by levels.]
+
+  Description [Replaces the node loops of Abc_SclTimeNtkRecompute() when
+  p->nThreads > 1. Arrivals are computed in the increasing order of levels,
+  departures in the decreasing order. The objects of one level depend only
+  on the objects of other levels and are split among the threads, while
+  small levels are processed by the calling thread. The results are the
+  same as those of the serial computation. CIs and COs are not processed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeNtkLevels( SC_Man * p, int fDept )
+{
+    Scl_ParMan_t Man, * pMan = &Man;
+    int i, nLevels;
+    memset( pMan, 0, sizeof(Scl_ParMan_t) );
+    pMan->p        = p;
+    pMan->fDept    = fDept;
+    pMan->nThreads = Abc_MinInt( Abc_MaxInt(p->nThreads, 1), SCL_PAR_THR_MAX );
+    Abc_SclTimeParLevels( pMan );
+    nLevels = Vec_IntSize(pMan->vStarts) - 1;
+#ifdef ABC_USE_PTHREADS
+    if ( pMan->nThreads > 1 )
+    {
+        Scl_ParThr_t ThData[SCL_PAR_THR_MAX];
+        pthread_t WorkerThread[SCL_PAR_THR_MAX];
+        int status;
+        status = pthread_mutex_init( &pMan->Mutex, NULL );      assert( status == 0 );
+        status = pthread_cond_init( &pMan->CondStart, NULL );   assert( status == 0 );
+        status = pthread_cond_init( &pMan->CondDone, NULL );    assert( status == 0 );
+        for ( i = 1; i < pMan->nThreads; i++ )
+        {
+            ThData[i].pMan    = pMan;
+            ThData[i].iThread = i;
+            status = pthread_create( WorkerThread + i, NULL, Abc_SclTimeParWorker, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nLevels; i++ )
+        {
+            int iLevel = fDept ? nLevels - 1 - i : i;
+            if ( Vec_IntEntry(pMan->vStarts, iLevel + 1) - Vec_IntEntry(pMan->vStarts, iLevel) >= SCL_PAR_LEV_MIN )
+                Abc_SclTimeParLevel( pMan, iLevel );
+            else
+                Abc_SclTimeParRange( pMan, iLevel, 0, 1 );
+        }
+        pthread_mutex_lock( &pMan->Mutex );
+        pMan->fStop = 1;
+        pthread_cond_broadcast( &pMan->CondStart );
+        pthread_mutex_unlock( &pMan->Mutex );
+        for ( i = 1; i < pMan->nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );    assert( status == 0 );
+        }
+        pthread_cond_destroy( &pMan->CondStart );
+        pthread_cond_destroy( &pMan->CondDone );
+        pthread_mutex_destroy( &pMan->Mutex );
+    }
+    else
+#endif
+    for ( i = 0; i < nLevels; i++ )
+        Abc_SclTimeParRange( pMan, fDept ? nLevels - 1 - i : i, 0, 1 );
+    for ( i = 0; i < pMan->nThreads; i++ )
+        p->nEstNodes += pMan->nEstNodes[i];
+    Vec_IntFree( pMan->vStarts );
+    Vec_IntFree( pMan->vObjs );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
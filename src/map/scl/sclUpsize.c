@@ -20,6 +20,17 @@
 
 #include "sclSize.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +38,36 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SCL_UPS_THR_MAX 64
+
+typedef struct Scl_UpsMan_t_ Scl_UpsMan_t;
+struct Scl_UpsMan_t_
+{
+    SC_Man *         p;             // the timing manager
+    Vec_Int_t *      vCands;        // candidate nodes
+    Vec_Wec_t *      vRecalcs;      // nodes to recompute for each candidate
+    Vec_Wec_t *      vEvals;        // nodes to evaluate for each candidate
+    Vec_Int_t *      vGates;        // the best gate of each candidate
+    Vec_Flt_t *      vGains;        // the best gain of each candidate
+    int              Notches;       // the limit on upsizing steps
+    int              DelayGap;      // the delay gap
+    int              fDnsize;       // looking for smaller gates that do not increase delay
+    int              iNext;         // the next candidate to evaluate
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;         // protects iNext
+#endif
+};
+
+typedef struct Scl_UpsThr_t_ Scl_UpsThr_t;
+struct Scl_UpsThr_t_
+{
+    Scl_UpsMan_t *   pMan;          // the shared data
+    int              nCap;          // the size of the scratch arrays
+    SC_Pair *        pLoads;        // window loads
+    SC_Pair *        pTimes;        // window arrival times
+    SC_Pair *        pSlews;        // window slews
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -322,6 +363,301 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     return gateBest;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Evaluates gate sizes without modifying the network.]
+
+  Description [Performs the same computation as Abc_SclFindBestCell() but
+  keeps the loads and the timing of the window in thread-local scratch
+  arrays, while the timing manager and the network are only read. This
+  allows for evaluating several candidates concurrently. The gains are
+  the same as those computed by Abc_SclFindBestCell().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclWinFind( Vec_Int_t * vWin, int Id )
+{
+    int * pArray = Vec_IntArray( vWin );
+    int iBeg = 0, iEnd = Vec_IntSize(vWin) - 1;
+    while ( iBeg <= iEnd )
+    {
+        int iMid = (iBeg + iEnd) / 2;
+        if ( pArray[iMid] == Id )
+            return iMid;
+        if ( pArray[iMid] < Id )
+            iBeg = iMid + 1;
+        else
+            iEnd = iMid - 1;
+    }
+    return -1;
+}
+static inline void Abc_SclTimeNodeWin( SC_Man * p, Scl_UpsThr_t * pThr, Vec_Int_t * vRecalcs, Abc_Obj_t * pObj, SC_Cell * pCell, int iWin )
+{
+    SC_Pair Load    = pThr->pLoads[iWin];
+    SC_Pair * pTime = pThr->pTimes + iWin;
+    SC_Pair * pSlew = pThr->pSlews + iWin;
+    Abc_Obj_t * pFanin;
+    float Value;
+    int k, iFanin;
+    pTime->rise = pTime->fall = 0;
+    pSlew->rise = pSlew->fall = 0;
+    if ( Abc_ObjIsCi(pObj) )
+    {
+        if ( p->pPiDrive != NULL )
+            Scl_LibHandleInputDriver( p->pPiDrive, &Load, pTime, pSlew );
+        return;
+    }
+    assert( Abc_ObjIsNode(pObj) );
+    Value = p->EstLoadMax ? (0.5 * Load.fall + 0.5 * Load.rise) / (p->EstLoadAve * p->EstLoadMax) : 0;
+    if ( p->EstLoadMax && Value > 1 )
+    {
+        Load.rise = p->EstLoadAve * p->EstLoadMax;
+        Load.fall = p->EstLoadAve * p->EstLoadMax;
+    }
+    Abc_ObjForEachFanin( pObj, pFanin, k )
+    {
+        iFanin = Abc_SclWinFind( vRecalcs, Abc_ObjId(pFanin) );
+        Scl_LibPinArrival( Scl_CellPinTime(pCell, k), 
+            iFanin >= 0 ? pThr->pTimes + iFanin : Abc_SclObjTime(p, pFanin), 
+            iFanin >= 0 ? pThr->pSlews + iFanin : Abc_SclObjSlew(p, pFanin), &Load, pTime, pSlew );
+    }
+    if ( p->EstLoadMax && Value > 1 )
+    {
+        float EstDelta = p->EstLinear * log( Value );
+        pTime->rise += EstDelta;
+        pTime->fall += EstDelta;
+    }
+}
+void Abc_SclTimeCellWin( SC_Man * p, Scl_UpsThr_t * pThr, Abc_Obj_t * pPivot, SC_Cell * pCellOld, SC_Cell * pCellNew, Vec_Int_t * vRecalcs )
+{
+    Abc_Obj_t * pObj;
+    int i, iWin;
+    // update loads of the fanins
+    Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pObj, i )
+        pThr->pLoads[i] = *Abc_SclObjLoad( p, pObj );
+    Abc_ObjForEachFanin( pPivot, pObj, i )
+    {
+        if ( (iWin = Abc_SclWinFind(vRecalcs, Abc_ObjId(pObj))) == -1 )
+            continue;
+        pThr->pLoads[iWin].rise += SC_CellPin(pCellNew, i)->rise_cap - SC_CellPin(pCellOld, i)->rise_cap;
+        pThr->pLoads[iWin].fall += SC_CellPin(pCellNew, i)->fall_cap - SC_CellPin(pCellOld, i)->fall_cap;
+    }
+    // recompute timing
+    Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pObj, i )
+        Abc_SclTimeNodeWin( p, pThr, vRecalcs, pObj, pObj == pPivot ? pCellNew : Abc_SclObjCell(pObj), i );
+}
+float Abc_SclEvalCellWin( SC_Man * p, Scl_UpsThr_t * pThr, Abc_Obj_t * pPivot, SC_Cell * pCellOld, SC_Cell * pCellNew, Vec_Int_t * vRecalcs, Vec_Int_t * vEvals )
+{
+    Abc_Obj_t * pObj;
+    float Diff, Multi = 1.5, Eval = 0;
+    int i, iWin;
+    Abc_SclTimeCellWin( p, pThr, pPivot, pCellOld, pCellNew, vRecalcs );
+    // compare with the current timing
+    Abc_NtkForEachObjVec( vEvals, p->pNtk, pObj, i )
+    {
+        iWin  = Abc_SclWinFind( vRecalcs, Abc_ObjId(pObj) );
+        assert( iWin >= 0 );
+        Diff  = (Abc_SclObjTime(p, pObj)->rise - pThr->pTimes[iWin].rise);
+        Diff += (Abc_SclObjTime(p, pObj)->fall - pThr->pTimes[iWin].fall);
+        Eval += 0.5 * (Diff > 0 ? Diff : Multi * Diff);
+    }
+    return Eval / Vec_IntSize(vEvals);
+}
+float Abc_SclEvalCellWinLegal( SC_Man * p, Scl_UpsThr_t * pThr, Abc_Obj_t * pPivot, SC_Cell * pCellOld, SC_Cell * pCellNew, Vec_Int_t * vRecalcs, Vec_Int_t * vEvals, float D )
+{
+    // same as Abc_SclEvalPerformLegal() for the window timing
+    Abc_Obj_t * pObj;
+    float Rise, Fall, Eval = 0;
+    int i, iWin;
+    Abc_SclTimeCellWin( p, pThr, pPivot, pCellOld, pCellNew, vRecalcs );
+    Abc_NtkForEachObjVec( vEvals, p->pNtk, pObj, i )
+    {
+        iWin = Abc_SclWinFind( vRecalcs, Abc_ObjId(pObj) );
+        assert( iWin >= 0 );
+        Rise = Abc_SclObjTime(p, pObj)->rise - pThr->pTimes[iWin].rise;
+        Fall = Abc_SclObjTime(p, pObj)->fall - pThr->pTimes[iWin].fall;
+        if ( Rise + Abc_SclObjGetSlackR(p, pObj, D) < 0 || Fall + Abc_SclObjGetSlackF(p, pObj, D) < 0 )
+             return -1;
+        Eval += 0.5 * Rise + 0.5 * Fall;
+    }
+    return Eval / Vec_IntSize(vEvals);
+}
+int Abc_SclFindBestCellWin( SC_Man * p, Scl_UpsThr_t * pThr, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec_Int_t * vEvals, int Notches, int DelayGap, int fDnsize, float * pGainBest )
+{
+    SC_Cell * pCellOld, * pCellNew;
+    float dGain, dGainBest;
+    int k, gateBest, NoChange = 0;
+    if ( pThr->nCap < Vec_IntSize(vRecalcs) )
+    {
+        pThr->nCap   = 2 * Vec_IntSize(vRecalcs);
+        pThr->pLoads = ABC_REALLOC( SC_Pair, pThr->pLoads, pThr->nCap );
+        pThr->pTimes = ABC_REALLOC( SC_Pair, pThr->pTimes, pThr->nCap );
+        pThr->pSlews = ABC_REALLOC( SC_Pair, pThr->pSlews, pThr->nCap );
+    }
+    pCellOld = Abc_SclObjCell( pObj );
+    gateBest = -1;
+    dGainBest = -DelayGap;
+    if ( fDnsize ) // same as Abc_SclCheckImprovement()
+    {
+        SC_RingForEachCellRev( pCellOld, pCellNew, k )
+        {
+            if ( pCellNew->area >= pCellOld->area )
+                continue;
+            if ( k > Notches )
+                break;
+            dGain = Abc_SclEvalCellWinLegal( p, pThr, pObj, pCellOld, pCellNew, vRecalcs, vEvals, p->MaxDelay0 );
+            if ( dGain == -1 )
+                continue;
+            if ( dGainBest < dGain )
+            {
+                dGainBest = dGain;
+                gateBest = pCellNew->Id;
+            }
+        }
+        *pGainBest = dGainBest;
+        return gateBest;
+    }
+    SC_RingForEachCell( pCellOld, pCellNew, k )
+    {
+        if ( pCellNew == pCellOld )
+            continue;
+        if ( k > Notches )
+            break;
+        dGain = Abc_SclEvalCellWin( p, pThr, pObj, pCellOld, pCellNew, vRecalcs, vEvals );
+        if ( dGainBest < dGain )
+        {
+            dGainBest = dGain;
+            gateBest = pCellNew->Id;
+            NoChange = 1;
+        }
+        else if ( NoChange )
+            NoChange++;
+        if ( NoChange == 4 )
+            break;
+    }
+    *pGainBest = dGainBest;
+    return gateBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates sizing candidates on several threads.]
+
+  Description [The windows of the candidates are computed by the calling
+  thread because this uses the node marks. Then the candidates are
+  distributed among the threads, each having its own scratch arrays.
+  When fDnsize is set, looks for smaller gates that keep the delay
+  within the original delay, as done by Abc_SclCheckImprovement().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclFindBestCellsRange( Scl_UpsThr_t * pThr )
+{
+    Scl_UpsMan_t * pMan = pThr->pMan;
+    SC_Man * p = pMan->p;
+    float dGainBest;
+    int i, gateBest;
+    while ( 1 )
+    {
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_lock( &pMan->Mutex );
+#endif
+        i = pMan->iNext++;
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_unlock( &pMan->Mutex );
+#endif
+        if ( i >= Vec_IntSize(pMan->vCands) )
+            break;
+        gateBest = Abc_SclFindBestCellWin( p, pThr, Abc_NtkObj(p->pNtk, Vec_IntEntry(pMan->vCands, i)), 
+            Vec_WecEntry(pMan->vRecalcs, i), Vec_WecEntry(pMan->vEvals, i), pMan->Notches, pMan->DelayGap, pMan->fDnsize, &dGainBest );
+        Vec_IntWriteEntry( pMan->vGates, i, gateBest );
+        Vec_FltWriteEntry( pMan->vGains, i, dGainBest );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+void * Abc_SclFindBestCellsWorker( void * pArg )
+{
+    Abc_SclFindBestCellsRange( (Scl_UpsThr_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+#endif
+void Abc_SclFindBestCellsParInt( SC_Man * p, Vec_Int_t * vCands, Vec_Wec_t * vRecalcs, Vec_Wec_t * vEvals, Vec_Int_t * vGates, Vec_Flt_t * vGains, int Notches, int DelayGap, int fDnsize )
+{
+    Scl_UpsThr_t ThData[SCL_UPS_THR_MAX];
+    Scl_UpsMan_t Man, * pMan = &Man;
+    int i, nThreads = Abc_MinInt( Abc_MaxInt(p->nThreads, 1), SCL_UPS_THR_MAX );
+    memset( pMan, 0, sizeof(Scl_UpsMan_t) );
+    memset( ThData, 0, sizeof(Scl_UpsThr_t) * nThreads );
+    pMan->p        = p;
+    pMan->vCands   = vCands;
+    pMan->vRecalcs = vRecalcs;
+    pMan->vEvals   = vEvals;
+    pMan->vGates   = vGates;
+    pMan->vGains   = vGains;
+    pMan->Notches  = Notches;
+    pMan->DelayGap = DelayGap;
+    pMan->fDnsize  = fDnsize;
+    Vec_IntFill( vGates, Vec_IntSize(vCands), -1 );
+    Vec_FltFill( vGains, Vec_IntSize(vCands), 0 );
+    for ( i = 0; i < nThreads; i++ )
+        ThData[i].pMan = pMan;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pMan->Mutex, NULL );
+    if ( nThreads > 1 && Vec_IntSize(vCands) > 1 )
+    {
+        pthread_t WorkerThread[SCL_UPS_THR_MAX];
+        int nStarted;
+        // if a thread cannot be created, the candidates are shared by the threads already running
+        for ( nStarted = 1; nStarted < nThreads; nStarted++ )
+            if ( pthread_create( WorkerThread + nStarted, NULL, Abc_SclFindBestCellsWorker, (void *)(ThData + nStarted) ) != 0 )
+                break;
+        Abc_SclFindBestCellsRange( ThData );
+        for ( i = 1; i < nStarted; i++ )
+            pthread_join( WorkerThread[i], NULL );
+    }
+    else
+        Abc_SclFindBestCellsRange( ThData );
+    pthread_mutex_destroy( &pMan->Mutex );
+#else
+    Abc_SclFindBestCellsRange( ThData );
+#endif
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ABC_FREE( ThData[i].pLoads );
+        ABC_FREE( ThData[i].pTimes );
+        ABC_FREE( ThData[i].pSlews );
+    }
+}
+void Abc_SclFindBestCellsPar( SC_Man * p, Vec_Int_t * vCands, Vec_Int_t * vGates, Vec_Flt_t * vGains, int Notches, int DelayGap )
+{
+    Vec_Wec_t * vRecalcsAll = Vec_WecStart( Vec_IntSize(vCands) );
+    Vec_Wec_t * vEvalsAll = Vec_WecStart( Vec_IntSize(vCands) );
+    Vec_Int_t * vRecalcs = Vec_IntAlloc( 100 );
+    Vec_Int_t * vEvals = Vec_IntAlloc( 100 );
+    Abc_Obj_t * pObj;
+    int i;
+    // compute nodes to recalculate timing and nodes to evaluate afterwards
+    Abc_NtkForEachObjVec( vCands, p->pNtk, pObj, i )
+    {
+        Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+        assert( Vec_IntSize(vEvals) > 0 );
+        Vec_IntAppend( Vec_WecEntry(vRecalcsAll, i), vRecalcs );
+        Vec_IntAppend( Vec_WecEntry(vEvalsAll, i), vEvals );
+    }
+    Vec_IntFree( vRecalcs );
+    Vec_IntFree( vEvals );
+    Abc_SclFindBestCellsParInt( p, vCands, vRecalcsAll, vEvalsAll, vGates, vGains, Notches, DelayGap, 0 );
+    Vec_WecFree( vRecalcsAll );
+    Vec_WecFree( vEvalsAll );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the set of gates to upsize.]
@@ -606,6 +942,35 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
     vRecalcs = Vec_IntAlloc( 100 );
     vEvals = Vec_IntAlloc( 100 );
     Vec_QueClear( p->vNodeByGain );
+    if ( p->nThreads > 1 && p->nCorners == 0 ) // window evaluation does not support timing corners
+    {
+        Vec_Int_t * vCands = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Int_t * vGates = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Flt_t * vGains = Vec_FltAlloc( Vec_IntSize(vPathNodes) );
+        Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+        {
+            assert( pObj->fMarkB == 0 );
+            iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+            if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+                continue;
+            Vec_IntPush( vCands, Abc_ObjId(pObj) );
+        }
+        Abc_SclFindBestCellsPar( p, vCands, vGates, vGains, Notches, DelayGap );
+        // remember savings in the same order as the serial evaluation
+        Abc_NtkForEachObjVec( vCands, p->pNtk, pObj, i )
+        {
+            if ( (gateBest = Vec_IntEntry(vGates, i)) < 0 )
+                continue;
+            assert( Vec_FltEntry(vGains, i) > 0.0 );
+            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), Vec_FltEntry(vGains, i) );
+            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
+            Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+        }
+        Vec_IntFree( vCands );
+        Vec_IntFree( vGates );
+        Vec_FltFree( vGains );
+    }
+    else
     Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
     {
         assert( pObj->fMarkB == 0 );
@@ -890,7 +1255,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nThreads );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
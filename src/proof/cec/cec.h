@@ -52,6 +52,7 @@ struct Cec_ParSat_t_
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
     int              fSaveCexes;    // saves counter-examples
+    int              fOrderCalls;   // orders SAT calls using simulation and batches them by cones
     int              fVerbose;      // verbose stats
 };
 
@@ -126,6 +127,8 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nProcs;        // the number of threads for output partitions
+    int              nPartSize;     // the support size limit of an output partition
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -316,14 +316,15 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
 
   Synopsis    [New CEC engine.]
 
-  Description []
+  Description [If ppUndec is not NULL, the old CEC engine is not called. 
+  Instead, the miter reduced by SAT sweeping is returned in *ppUndec.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
+int Cec_ManVerifyInt( Gia_Man_t * pInit, Cec_ParCec_t * pPars, Gia_Man_t ** ppUndec )
 {
     int fDumpUndecided = 0;
     Cec_ParFra_t ParsFra, * pParsFra = &ParsFra;
@@ -400,6 +401,11 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
         Gia_ManStop( pNew );
         return -1;
     }
+    if ( ppUndec )
+    {
+        *ppUndec = pNew;
+        return -1;
+    }
     // call other solver
     if ( pPars->fVerbose )
         Abc_Print( 1, "Calling the old CEC engine.\n" );
@@ -411,6 +417,12 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     Gia_ManStop( pNew );
     return RetValue;
 }
+int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
+{
+    if ( pPars->nProcs > 0 && !pPars->fNaive && Gia_ManPoNum(pInit) > 2 )
+        return Cec_ManVerifyPart( pInit, pPars );
+    return Cec_ManVerifyInt( pInit, pPars, NULL );
+}
 
 /**Function*************************************************************
 
@@ -86,6 +86,9 @@ struct Cec_ManSat_t_
     Vec_Ptr_t *      vUsedNodes;     // nodes whose SAT vars are assigned
     int              nRecycles;      // the number of times SAT solver was recycled
     int              nCallsSince;    // the number of calls since the last recycle
+    int              nBatches;       // the number of batches of calls sharing a cone
+    int              nSimSat;        // the number of outputs disproved by simulation
+    int              fNoRecycle;     // prevents recycling inside a batch
     Vec_Ptr_t *      vFanins;        // fanins of the CNF node
     // counter-examples
     Vec_Int_t *      vCex;           // the latest counter-example
@@ -170,6 +173,9 @@ struct Cec_ManFra_t_
 
 /*=== cecCorr.c ============================================================*/
 extern void                 Cec_ManRefinedClassPrintStats( Gia_Man_t * p, Vec_Str_t * vStatus, int iIter, abctime Time );
+/*=== cecCec.c ============================================================*/
+extern int                  Cec_ManVerifyOld( Gia_Man_t * pMiter, int fVerbose, int * piOutFail, abctime clkTotal, int fSilent );
+extern int                  Cec_ManVerifyInt( Gia_Man_t * pInit, Cec_ParCec_t * pPars, Gia_Man_t ** ppUndec );
 /*=== cecClass.c ============================================================*/
 extern int                  Cec_ManSimClassRemoveOne( Cec_ManSim_t * p, int i );
 extern int                  Cec_ManSimClassesPrepare( Cec_ManSim_t * p, int LevelMax );
@@ -188,6 +194,8 @@ extern Cec_ManSim_t *       Cec_ManSimStart( Gia_Man_t * pAig, Cec_ParSim_t *  p
 extern void                 Cec_ManSimStop( Cec_ManSim_t * p );  
 extern Cec_ManFra_t *       Cec_ManFraStart( Gia_Man_t * pAig, Cec_ParFra_t *  pPars );  
 extern void                 Cec_ManFraStop( Cec_ManFra_t * p );
+/*=== cecPart.c ============================================================*/
+extern int                  Cec_ManVerifyPart( Gia_Man_t * p, Cec_ParCec_t * pPars );
 /*=== cecPat.c ============================================================*/
 extern void                 Cec_ManPatSavePattern( Cec_ManPat_t *  pPat, Cec_ManSat_t *  p, Gia_Obj_t * pObj );
 extern void                 Cec_ManPatSavePatternCSat( Cec_ManPat_t * pMan, Vec_Int_t * vPat );
@@ -87,6 +87,14 @@ void Cec_ManSatPrintStats( Cec_ManSat_t * p )
     Abc_Print( 1, "Undef calls %6d  (%6.2f %%)   Ave conf = %8.1f   ", 
         p->nSatUndec, p->nSatTotal? 100.0*p->nSatUndec/p->nSatTotal : 0.0, p->nSatUndec? 1.0*p->nConfUndec/p->nSatUndec : 0.0 );
     Abc_PrintTimeP( 1, "Time", p->timeSatUndec, p->timeTotal );
+    if ( p->pPars->fOrderCalls )
+        Abc_Print( 1, "Batches = %d.  Disproved by simulation = %d.\n", p->nBatches, p->nSimSat );
+    {
+        double Secs = Abc_MaxInt(1, p->timeTotal) / (double)CLOCKS_PER_SEC;
+        int nConfs  = p->nConfUnsat + p->nConfSat + p->nConfUndec;
+        Abc_Print( 1, "Calls = %d (%.1f /sec)  Conflicts = %d (%.1f /sec)  Recycles = %d (%.1f /sec)\n", 
+            p->nSatTotal, p->nSatTotal / Secs, nConfs, nConfs / Secs, p->nRecycles, p->nRecycles / Secs );
+    }
     Abc_PrintTime( 1, "Total time", p->timeTotal );
 }
 
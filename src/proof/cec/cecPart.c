@@ -0,0 +1,399 @@
+/**CFile****************************************************************
+
+  FileName    [cecPart.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Output-partitioned checking of combinational miters.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: cecPart.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+#include "aig/gia/giaAig.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CEC_PART_THR_MAX 100
+
+typedef struct Cec_PartMan_t_ Cec_PartMan_t;
+struct Cec_PartMan_t_
+{
+    Gia_Man_t *      pAig;          // the dual-output miter
+    Cec_ParCec_t *   pPars;         // the parameters
+    Vec_Ptr_t *      vParts;        // output pairs of each partition
+    Gia_Man_t **     pMiters;       // miters of the partitions
+    Gia_Man_t **     pUndecs;       // reduced miters of the undecided partitions
+    Vec_Int_t **     pvCiMaps;      // CIs of the miter used by each partition
+    int *            pStatus;       // statuses of the partitions
+    abctime *        pTimes;        // runtimes of the partitions
+    int              iNext;         // the next partition to be solved
+    int              fStop;         // stops the workers after a failed partition
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;         // protects iNext and fStop
+#endif
+};
+
+// Abc_Clock() measures the time of the calling thread, while the total
+// runtime of the concurrent partitions should be measured by the wall clock
+static inline abctime Cec_ManPartWallClock()
+{
+#if (defined(LIN) || defined(LIN64)) && !(__APPLE__ & __MACH__) && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    return ((abctime) ts.tv_sec) * CLOCKS_PER_SEC + (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+#else
+    return Abc_Clock();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the output pairs of the dual-output miter.]
+
+  Description [Groups the output pairs whose structural supports overlap
+  as much as possible, while keeping the support size of each partition
+  close to nPartSize. Returns the array of partitions, each of which is
+  the array of output pair indexes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Cec_ManPartitionOutputs( Gia_Man_t * p, int nPartSize, int fVerbose )
+{
+    Vec_Ptr_t * vParts;
+    Vec_Int_t * vPart;
+    Gia_Man_t * pTemp = Gia_ManTransformMiter( p );
+    Aig_Man_t * pAig  = Gia_ManToAigSimple( pTemp );
+    int i;
+    Gia_ManStop( pTemp );
+    vParts = Aig_ManPartitionSmart( pAig, nPartSize, 0, NULL );
+    Aig_ManStop( pAig );
+    // keep the original order of outputs inside each partition
+    Vec_PtrForEachEntry( Vec_Int_t *, vParts, vPart, i )
+        Vec_IntSort( vPart, 0 );
+    if ( fVerbose )
+        Abc_Print( 1, "Divided %d output pairs into %d partitions with support limit %d.\n",
+            Gia_ManPoNum(p)/2, Vec_PtrSize(vParts), nPartSize );
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the dual-output miter of one partition.]
+
+  Description [The cones are copied from the structurally hashed miter
+  and keep only the CIs in their support. Returns the indexes of these CIs
+  in the original miter in *pvCiMap, in the order of the new CIs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_ManPartDeriveMiter( Gia_Man_t * p, Vec_Int_t * vPart, Vec_Int_t ** pvCiMap )
+{
+    Gia_Man_t * pNew;
+    Vec_Int_t * vPos = Vec_IntAlloc( 2 * Vec_IntSize(vPart) );
+    Vec_Int_t * vSupp = Vec_IntAlloc( 100 );
+    int i, iPair, iObj;
+    Vec_IntForEachEntry( vPart, iPair, i )
+    {
+        Vec_IntPush( vPos, 2*iPair   );
+        Vec_IntPush( vPos, 2*iPair+1 );
+    }
+    pNew = Gia_ManDupCones( p, Vec_IntArray(vPos), Vec_IntSize(vPos), 1 );
+    // the CIs of the new miter are ordered by their index in the old one
+    Vec_IntForEachEntry( vPos, iPair, i )
+        Vec_IntWriteEntry( vPos, i, Gia_ObjId(p, Gia_ManPo(p, iPair)) );
+    Gia_ManCollectCis( p, Vec_IntArray(vPos), Vec_IntSize(vPos), vSupp );
+    Vec_IntForEachEntry( vSupp, iObj, i )
+        Vec_IntWriteEntry( vSupp, i, Gia_ObjCioId(Gia_ManObj(p, iObj)) );
+    Vec_IntSort( vSupp, 0 );
+    assert( Gia_ManCiNum(pNew) == Vec_IntSize(vSupp) );
+    Vec_IntFree( vPos );
+    *pvCiMap = vSupp;
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the counter-example of a partition to the miter.]
+
+  Description [The CIs not used by the partition are set to 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Cec_ManPartMapCex( Gia_Man_t * p, Abc_Cex_t * pCex, Vec_Int_t * vPart, Vec_Int_t * vCiMap )
+{
+    Abc_Cex_t * pNew = Abc_CexAlloc( 0, Gia_ManCiNum(p), 1 );
+    int k, iCi;
+    assert( pCex->nPis == Vec_IntSize(vCiMap) );
+    pNew->iPo = Vec_IntEntry( vPart, pCex->iPo );
+    Vec_IntForEachEntry( vCiMap, iCi, k )
+        if ( Abc_InfoHasBit(pCex->pData, pCex->nRegs + k) )
+            Abc_InfoSetBit( pNew->pData, iCi );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one partition.]
+
+  Description [Runs the SAT-sweeping part of the CEC engine. The old CEC
+  engine is not called here because it relies on the shared CNF manager;
+  the partitions left undecided are finished by the calling thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManPartSolveOne( Cec_PartMan_t * p, int iPart )
+{
+    Cec_ParCec_t Pars = *p->pPars;
+    abctime clk = Abc_Clock();
+    Pars.fSilent  = 1;
+    Pars.fVerbose = 0;
+    // the random patterns of each partition do not depend on the thread solving it
+    Gia_ManRandom( 1 );
+    p->pStatus[iPart] = Cec_ManVerifyInt( p->pMiters[iPart], &Pars, &p->pUndecs[iPart] );
+    p->pTimes[iPart]  = Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the next partition to be solved or -1.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ManPartFetch( Cec_PartMan_t * p )
+{
+    int iPart = -1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    if ( !p->fStop && p->iNext < Vec_PtrSize(p->vParts) )
+        iPart = p->iNext++;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return iPart;
+}
+static inline void Cec_ManPartSetStop( Cec_PartMan_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    p->fStop = 1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+void * Cec_ManPartWorkerThread( void * pArg )
+{
+    Cec_PartMan_t * p = (Cec_PartMan_t *)pArg;
+    int iPart;
+    while ( (iPart = Cec_ManPartFetch(p)) >= 0 )
+    {
+        Cec_ManPartSolveOne( p, iPart );
+        if ( p->pStatus[iPart] == 0 )
+            Cec_ManPartSetStop( p );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the partitions using the given number of threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManPartSolveAll( Cec_PartMan_t * p, int nProcs )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[CEC_PART_THR_MAX];
+    int i, status;
+    nProcs = Abc_MinInt( nProcs, Abc_MinInt(CEC_PART_THR_MAX, Vec_PtrSize(p->vParts)) );
+    if ( nProcs > 1 )
+    {
+        pthread_mutex_init( &p->Mutex, NULL );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Cec_ManPartWorkerThread, (void *)p );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nProcs; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        pthread_mutex_destroy( &p->Mutex );
+        return;
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    Cec_ManPartWorkerThread( p );
+    pthread_mutex_destroy( &p->Mutex );
+#else
+    Cec_ManPartWorkerThread( p );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Output-partitioned CEC engine.]
+
+  Description [Divides the output pairs of the dual-output miter into
+  partitions with small support overlap and verifies them concurrently.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManVerifyPart( Gia_Man_t * pAig, Cec_ParCec_t * pPars )
+{
+    Cec_PartMan_t Man, * p = &Man;
+    Vec_Int_t * vPart;
+    Abc_Cex_t * pCex;
+    abctime clkTotal = Cec_ManPartWallClock();
+    int i, nParts, iOutFail, RetValue = 1;
+    assert( Gia_ManPoNum(pAig) % 2 == 0 );
+    assert( Gia_ManRegNum(pAig) == 0 );
+    Abc_CexFreeP( &pAig->pCexComb );
+    memset( p, 0, sizeof(Cec_PartMan_t) );
+    p->pAig    = pAig;
+    p->pPars   = pPars;
+    p->vParts  = Cec_ManPartitionOutputs( pAig, pPars->nPartSize, pPars->fVerbose );
+    nParts     = Vec_PtrSize( p->vParts );
+    p->pMiters = ABC_CALLOC( Gia_Man_t *, nParts );
+    p->pUndecs = ABC_CALLOC( Gia_Man_t *, nParts );
+    p->pvCiMaps = ABC_CALLOC( Vec_Int_t *, nParts );
+    p->pStatus = ABC_FALLOC( int, nParts );
+    p->pTimes  = ABC_CALLOC( abctime, nParts );
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vParts, vPart, i )
+        p->pMiters[i] = Cec_ManPartDeriveMiter( pAig, vPart, &p->pvCiMaps[i] );
+    // run SAT sweeping on the partitions in parallel
+    Cec_ManPartSolveAll( p, pPars->nProcs );
+    // finish the undecided partitions with the old CEC engine
+    for ( i = 0; i < nParts && !p->fStop; i++ )
+    {
+        abctime clk = Abc_Clock();
+        if ( p->pUndecs[i] == NULL )
+            continue;
+        if ( pPars->TimeLimit && (Cec_ManPartWallClock() - clkTotal)/CLOCKS_PER_SEC >= pPars->TimeLimit )
+            break;
+        p->pStatus[i] = Cec_ManVerifyOld( p->pUndecs[i], 0, &iOutFail, clk, 1 );
+        ABC_SWAP( Abc_Cex_t *, p->pMiters[i]->pCexComb, p->pUndecs[i]->pCexComb );
+        p->pTimes[i] += Abc_Clock() - clk;
+        if ( p->pStatus[i] == 0 )
+            p->fStop = 1;
+    }
+    // report the partitions
+    if ( pPars->fVerbose )
+    {
+        Vec_PtrForEachEntry( Vec_Int_t *, p->vParts, vPart, i )
+        {
+            Abc_Print( 1, "Part %5d :  Pairs =%6d.  And =%8d.  ", i, Vec_IntSize(vPart), Gia_ManAndNum(p->pMiters[i]) );
+            Abc_Print( 1, "%s  ", p->pStatus[i] == 1 ? "UNSAT  " : (p->pStatus[i] == 0 ? "SAT    " : "UNDEC  ") );
+            Abc_PrintTime( 1, "Time", p->pTimes[i] );
+        }
+    }
+    // collect the results
+    for ( i = 0; i < nParts; i++ )
+        if ( p->pStatus[i] == 0 )
+            break;
+    if ( i < nParts )
+    {
+        RetValue = 0;
+        if ( p->pMiters[i]->pCexComb != NULL )
+        {
+            pCex = Cec_ManPartMapCex( pAig, p->pMiters[i]->pCexComb, (Vec_Int_t *)Vec_PtrEntry(p->vParts, i), p->pvCiMaps[i] );
+            pPars->iOutFail = pCex->iPo;
+            pAig->pCexComb = pCex;
+            if ( !Gia_ManVerifyCex( pAig, pCex, 1 ) )
+                Abc_Print( 1, "Counter-example simulation has failed.\n" );
+        }
+    }
+    else
+    {
+        for ( i = 0; i < nParts; i++ )
+            if ( p->pStatus[i] != 1 )
+                RetValue = -1;
+    }
+    if ( !pPars->fSilent )
+    {
+        if ( RetValue == 1 )
+            Abc_Print( 1, "Networks are equivalent.  " );
+        else if ( RetValue == 0 )
+            Abc_Print( 1, "Networks are NOT EQUIVALENT.  " );
+        else
+            Abc_Print( 1, "Networks are UNDECIDED.  " );
+        Abc_Print( 1, "Partitions = %d.  Threads = %d.  ", nParts, pPars->nProcs );
+        Abc_PrintTime( 1, "Time", Cec_ManPartWallClock() - clkTotal );
+    }
+    // cleanup
+    for ( i = 0; i < nParts; i++ )
+    {
+        Gia_ManStopP( &p->pMiters[i] );
+        Gia_ManStopP( &p->pUndecs[i] );
+        Vec_IntFreeP( &p->pvCiMaps[i] );
+    }
+    ABC_FREE( p->pMiters );
+    ABC_FREE( p->pUndecs );
+    ABC_FREE( p->pvCiMaps );
+    ABC_FREE( p->pStatus );
+    ABC_FREE( p->pTimes );
+    Vec_VecFree( (Vec_Vec_t *)p->vParts );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
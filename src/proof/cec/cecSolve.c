@@ -487,7 +487,7 @@ int Cec_ManSatCheckNode( Cec_ManSat_t * p, Gia_Obj_t * pObj )
     
     // check if SAT solver needs recycling
     if ( p->pSat == NULL || 
-        (p->pPars->nSatVarMax && 
+        (p->pPars->nSatVarMax && !p->fNoRecycle &&
          p->nSatVars > p->pPars->nSatVarMax && 
          p->nCallsSince > p->pPars->nCallsRecycle) )
         Cec_ManSatSolverRecycle( p );
@@ -661,6 +661,98 @@ p->timeSatUndec += Abc_Clock() - clk;
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the order of SAT calls for the COs.]
+
+  Description [Simulates the AIG with random patterns. The COs that are 
+  disproved by simulation come first, because their SAT calls are easy 
+  and the resulting patterns refine the candidates early. The remaining 
+  COs are grouped into batches whose drivers compare against the same 
+  node (for example, the representative of an equivalence class), so that 
+  they reuse the CNF loaded into the solver. The batches follow in the 
+  topological order of these nodes, and within a batch the COs are sorted
+  by level as an estimate of difficulty. Each entry is the literal whose
+  variable is the CO index and whose complement marks the batch start.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec_ManSatSolveOrder( Gia_Man_t * pAig, int nWords, int * pnSimSat )
+{
+    Vec_Int_t * vOrder, * vLevels, * vBatch;
+    Vec_Wec_t * vBatches;
+    Vec_Wrd_t * vSims;
+    Gia_Obj_t * pObj, * pFan0, * pFan1;
+    word * pSim, * pSim0, * pSim1, Mask0, Mask1, Res;
+    int i, k, w, iAnchor, * pPerm, * pCosts;
+    // simulate random patterns
+    Gia_ManRandom( 1 );
+    vSims = Vec_WrdStart( nWords * Gia_ManObjNum(pAig) );
+    Gia_ManForEachObj1( pAig, pObj, i )
+    {
+        pSim = Vec_WrdEntryP( vSims, nWords * i );
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            for ( w = 0; w < nWords; w++ )
+                pSim[w] = Gia_ManRandomW( 0 );
+            continue;
+        }
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        pSim0 = Vec_WrdEntryP( vSims, nWords * Gia_ObjFaninId0(pObj, i) );
+        pSim1 = Vec_WrdEntryP( vSims, nWords * Gia_ObjFaninId1(pObj, i) );
+        Mask0 = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        Mask1 = Gia_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        for ( w = 0; w < nWords; w++ )
+            pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+    }
+    // collect COs disproved by simulation and batches of the other COs
+    vOrder   = Vec_IntAlloc( Gia_ManCoNum(pAig) );
+    vLevels  = Vec_IntStart( Gia_ManCoNum(pAig) );
+    vBatches = Vec_WecStart( Gia_ManObjNum(pAig) );
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        pSim0 = Vec_WrdEntryP( vSims, nWords * Gia_ObjFaninId0p(pAig, pObj) );
+        Mask0 = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        for ( Res = 0, w = 0; w < nWords; w++ )
+            Res |= pSim0[w] ^ Mask0;
+        if ( Res )
+        {
+            Vec_IntPush( vOrder, Abc_Var2Lit(i, 1) );
+            continue;
+        }
+        pObj = Gia_ObjFanin0(pObj);
+        if ( Gia_ObjIsAnd(pObj) && Gia_ObjRecognizeExor(pObj, &pFan0, &pFan1) )
+            iAnchor = Abc_MinInt( Gia_ObjId(pAig, Gia_Regular(pFan0)), Gia_ObjId(pAig, Gia_Regular(pFan1)) );
+        else
+            iAnchor = Gia_ObjId( pAig, pObj );
+        Vec_WecPush( vBatches, iAnchor, i );
+        Vec_IntWriteEntry( vLevels, i, Gia_ObjLevel(pAig, pObj) );
+    }
+    *pnSimSat = Vec_IntSize( vOrder );
+    Vec_WecForEachLevel( vBatches, vBatch, i )
+    {
+        if ( Vec_IntSize(vBatch) == 0 )
+            continue;
+        pCosts = ABC_ALLOC( int, Vec_IntSize(vBatch) );
+        Vec_IntForEachEntry( vBatch, iAnchor, k )
+            pCosts[k] = Vec_IntEntry( vLevels, iAnchor );
+        pPerm = Abc_QuickSortCost( pCosts, Vec_IntSize(vBatch), 0 );
+        for ( k = 0; k < Vec_IntSize(vBatch); k++ )
+            Vec_IntPush( vOrder, Abc_Var2Lit(Vec_IntEntry(vBatch, pPerm[k]), k == 0) );
+        ABC_FREE( pPerm );
+        ABC_FREE( pCosts );
+    }
+    assert( Vec_IntSize(vOrder) == Gia_ManCoNum(pAig) );
+    Vec_WecFree( vBatches );
+    Vec_IntFree( vLevels );
+    Vec_WrdFree( vSims );
+    return vOrder;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one round of solving for the POs of the AIG.]
@@ -693,7 +785,8 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
     Bar_Progress_t * pProgress = NULL;
     Cec_ManSat_t * p;
     Gia_Obj_t * pObj;
-    int i, status;
+    Vec_Int_t * vOrder = NULL;
+    int i, k, status, nSimSat = 0, nCallsBeg = 0;
     abctime clk = Abc_Clock(), clk2;
     Vec_PtrFreeP( &pAig->vSeqModelVec );
     if ( pPars->fSaveCexes )
@@ -708,11 +801,27 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
     } 
     Gia_ManSetPhase( pAig );
     Gia_ManLevelNum( pAig );
+    if ( pPars->fOrderCalls )
+        vOrder = Cec_ManSatSolveOrder( pAig, 4, &nSimSat );
     Gia_ManIncrementTravId( pAig );
     p = Cec_ManSatCreate( pAig, pPars );
+    p->nSimSat = nSimSat;
     pProgress = Bar_ProgressStart( stdout, Gia_ManPoNum(pAig) );
-    Gia_ManForEachCo( pAig, pObj, i )
+    for ( k = 0; k < Gia_ManCoNum(pAig); k++ )
     {
+        i = vOrder ? Abc_Lit2Var( Vec_IntEntry(vOrder, k) ) : k;
+        pObj = Gia_ManCo( pAig, i );
+        if ( vOrder )
+        {
+            // recycle the solver only between the batches
+            p->fNoRecycle = !Abc_LitIsCompl( Vec_IntEntry(vOrder, k) );
+            // count the previous batch if it needed SAT calls
+            if ( !p->fNoRecycle )
+            {
+                p->nBatches += k > nSimSat && p->nSatTotal > nCallsBeg;
+                nCallsBeg = p->nSatTotal;
+            }
+        }
         if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
         {
             pObj->fMark0 = 0;
@@ -721,7 +830,7 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
                 Vec_PtrWriteEntry( pAig->vSeqModelVec, i, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
             continue;
         }
-        Bar_ProgressUpdate( pProgress, i, "SAT..." );
+        Bar_ProgressUpdate( pProgress, k, "SAT..." );
 clk2 = Abc_Clock();
         status = Cec_ManSatCheckNode( p, Gia_ObjChild0(pObj) );
         pObj->fMark0 = (status == 0);
@@ -760,11 +869,15 @@ clk2 = Abc_Clock();
         if ( pPars->fCheckMiter )
             break;
     }
+    // count the last batch if all outputs were solved
+    if ( vOrder && k == Gia_ManCoNum(pAig) && k > nSimSat && p->nSatTotal > nCallsBeg )
+        p->nBatches++;
     p->timeTotal = Abc_Clock() - clk;
     Bar_ProgressStop( pProgress );
     if ( pPars->fVerbose )
         Cec_ManSatPrintStats( p );
     Cec_ManSatStop( p );
+    Vec_IntFreeP( &vOrder );
 }
 
 /**Function*************************************************************
@@ -74,6 +74,7 @@ struct Pdr_Par_t_
     int fStoreCex;        // enable storing counter-examples in MO mode
     int fUseBridge;       // use bridge interface
     int fUsePropOut;      // use property output
+    int fProveOuts;       // prove individual outputs using inductive lemmas shared by all outputs
     int nFailOuts;        // the number of failed outputs
     int nDropOuts;        // the number of timed out outputs
     int nProveOuts;       // the number of proved outputs
@@ -83,6 +84,7 @@ struct Pdr_Par_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     abctime timeLastSolved; // the time when the last output was solved
     Vec_Int_t * vOutMap;  // in the multi-output mode, contains status for each PO (0 = sat; 1 = unsat; negative = undecided)
+    char * pSumFileName;  // in the multi-output mode, file name for the per-output summary
 };
 
 ////////////////////////////////////////////////////////////////////////
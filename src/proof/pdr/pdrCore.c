@@ -1087,6 +1087,9 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             // skip output whose time has run out
             if ( p->pTime4Outs && p->pTime4Outs[p->iOutCur] == 0 )
                 continue;
+            // skip outputs proved using the shared clauses
+            if ( p->pPars->vOutMap && Vec_IntEntry(p->pPars->vOutMap, p->iOutCur) == 1 )
+                continue;
             // check if the output is trivially solved
             if ( Aig_ObjChild0(pObj) == Aig_ManConst0(p->pAig) )
                 continue;
@@ -1102,6 +1105,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 pCexNew = (p->pPars->fUseBridge || p->pPars->fStoreCex) ? Abc_CexMakeTriv( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), Saig_ManPoNum(p->pAig), iFrame*Saig_ManPoNum(p->pAig)+p->iOutCur ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
                 p->pPars->nFailOuts++;
                 if ( p->pPars->vOutMap ) Vec_IntWriteEntry( p->pPars->vOutMap, p->iOutCur, 0 );
+                if ( p->vFrame4Outs ) Vec_IntWriteEntry( p->vFrame4Outs, p->iOutCur, iFrame );
                 if ( !p->pPars->fNotVerbose )
                 Abc_Print( 1, "Output %*d was trivially asserted in frame %2d (solved %*d out of %*d outputs).\n",
                     nOutDigits, p->iOutCur, iFrame, nOutDigits, p->pPars->nFailOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
@@ -1124,10 +1128,10 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 continue;
             }
             // try to solve this output
+            clkOne = Abc_Clock();
             if ( p->pTime4Outs )
             {
                 assert( p->pTime4Outs[p->iOutCur] > 0 );
-                clkOne = Abc_Clock();
                 p->timeToStopOne = p->pTime4Outs[p->iOutCur] + Abc_Clock();
             }
             while ( 1 )
@@ -1218,6 +1222,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                         p->pPars->nFailOuts++;
                         pCexNew = (p->pPars->fUseBridge || p->pPars->fStoreCex) ? Pdr_ManDeriveCex(p) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
                         if ( p->pPars->vOutMap ) Vec_IntWriteEntry( p->pPars->vOutMap, p->iOutCur, 0 );
+                        if ( p->vFrame4Outs ) Vec_IntWriteEntry( p->vFrame4Outs, p->iOutCur, iFrame );
                         assert( Vec_PtrEntry(p->vCexes, p->iOutCur) == NULL );
                         if ( p->pPars->fUseBridge )
                             Gia_ManToBridgeResult( stdout, 0, pCexNew, pCexNew->iPo );
@@ -1235,7 +1240,10 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                             Abc_Print( 1, "Output %*d was asserted in frame %2d (%2d) (solved %*d out of %*d outputs).\n",
                                 nOutDigits, p->iOutCur, iFrame, iFrame, nOutDigits, p->pPars->nFailOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
                         if ( p->pPars->nFailOuts == Saig_ManPoNum(p->pAig) )
+                        {
+                            p->pTime4Solve[p->iOutCur] += Abc_Clock() - clkOne;
                             return 0; // all SAT
+                        }
                         Pdr_QueueClean( p );
                         pCube = NULL;
                         break; // keep solving
@@ -1244,6 +1252,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                         Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
                 }
             }
+            if ( p->pTime4Solve )
+                p->pTime4Solve[p->iOutCur] += Abc_Clock() - clkOne;
             if ( fRefined )
                 break;
             if ( p->pTime4Outs )
@@ -1318,6 +1328,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     if ( Vec_IntEntry(p->pPars->vOutMap, iFrame) == -2 ) // unknown
                     {
                         Vec_IntWriteEntry( p->pPars->vOutMap, iFrame, 1 ); // unsat
+                        Vec_IntWriteEntry( p->vFrame4Outs, iFrame, p->pPars->iFrame );
                         if ( p->pPars->fUseBridge )
                             Gia_ManToBridgeResult( stdout, 1, NULL, iFrame );
                     }
@@ -1327,6 +1338,20 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 return 0; // SAT
             return -1;
         }
+        // prove individual outputs using the clauses derived so far
+        if ( p->pPars->fSolveAll && p->pPars->fProveOuts )
+            Pdr_ManProveOutputs( p, iFrame );
+        if ( p->pPars->fSolveAll && p->pPars->fProveOuts && p->pPars->nFailOuts + p->pPars->nDropOuts + p->pPars->nProveOuts == Saig_ManPoNum(p->pAig) )
+        {
+            if ( p->pPars->fVerbose )
+                Pdr_ManPrintProgress( p, 1, Abc_Clock() - clkStart );
+            p->pPars->iFrame = iFrame;
+            if ( p->pPars->nProveOuts == Saig_ManPoNum(p->pAig) )
+                return 1; // UNSAT
+            if ( p->pPars->nFailOuts > 0 )
+                return 0; // SAT
+            return -1;
+        }
         if ( p->pPars->fVerbose )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
@@ -1431,6 +1456,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     else if ( RetValue == 1 )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
+    if ( pPars->pSumFileName )
+        Pdr_ManDumpSummary( p, pPars->pSumFileName );
     Pdr_ManStop( p );
     pPars->iFrame--;
     // convert all -2 (unknown) entries into -1 (undec)
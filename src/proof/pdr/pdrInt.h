@@ -139,6 +139,11 @@ struct Pdr_Man_t_
     Vec_Int_t * vCi2Rem;   // CIs to be removed
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
+    abctime *   pTime4Solve;// runtime spent on each output
+    Vec_Int_t * vFrame4Outs;// frame where each output was solved
+    Cnf_Dat_t * pCnfOuts;  // CNF of one frame used to prove individual outputs
+    sat_solver * pSatOuts; // solver used to prove individual outputs
+    Vec_Ptr_t * vOutCubes; // inductive clauses used to prove individual outputs
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
     // statistics
     int         nBlocks;   // the number of times blockState was called
@@ -171,6 +176,7 @@ struct Pdr_Man_t_
     abctime     tContain;
     abctime     tCnf;
     abctime     tAbs;
+    abctime     tProve;
     abctime     tTotal;
 };
 
@@ -211,6 +217,8 @@ extern Vec_Str_t *     Pdr_ManDumpString( Pdr_Man_t * p );
 extern void            Pdr_ManReportInvariant( Pdr_Man_t * p );
 extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
 extern Vec_Int_t *     Pdr_ManDeriveInfinityClauses( Pdr_Man_t * p, int fReduce );
+extern int             Pdr_ManProveOutputs( Pdr_Man_t * p, int iFrame );
+extern void            Pdr_ManDumpSummary( Pdr_Man_t * p, char * pFileName );
 /*=== pdrMan.c ==========================================================*/
 extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit );
 extern void            Pdr_ManStop( Pdr_Man_t * p );
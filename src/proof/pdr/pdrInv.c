@@ -30,6 +30,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -600,7 +602,17 @@ Vec_Int_t * Pdr_ManDeriveInfinityClauses( Pdr_Man_t * p, int fReduce )
     int i, v, kStart;
     // collect cubes used in the inductive invariant
     kStart = Pdr_ManFindInvariantStart( p );
-    vCubes = Pdr_ManCollectCubes( p, kStart );
+    if ( !fReduce && p->vOutCubes && Vec_PtrSize(Vec_VecEntry(p->vClauses, kStart)) > 0 )
+        vCubes = Vec_PtrAlloc( 100 ); // no fixed point, all outputs were proved using inductive subsets
+    else
+        vCubes = Pdr_ManCollectCubes( p, kStart );
+    // add the inductive clauses used to prove individual outputs
+    if ( !fReduce && p->vOutCubes )
+    {
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vOutCubes, pCube, i )
+            Vec_PtrPush( vCubes, pCube );
+        Vec_PtrUniqify2( vCubes, (int (*)(void **, void **))Pdr_SetCompare, NULL, NULL );
+    }
     // refine as long as there are changes
     if ( fReduce )
         while ( Pdr_ManDeriveMarkNonInductive(p, vCubes) );
@@ -976,6 +988,240 @@ Vec_Int_t * Pdr_InvMinimizeLits( Gia_Man_t * p, Vec_Int_t * vInv, int fVerbose )
     return vRes;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Proves individual outputs using the shared clauses.]
+
+  Description [Finds the largest subset of clauses in the last frame, which 
+  is inductive without assuming the property outputs, and checks each 
+  undecided output against this subset. The clauses are shared by all outputs,
+  so an output can be proved before the global invariant is found. 
+  The subset is found by asking whether any of the remaining clauses can 
+  be violated in the next state and dropping all clauses violated by the 
+  satisfying assignment, so the number of SAT calls is proportional to the
+  number of rounds rather than the square of the number of clauses.
+  The solver with one frame of the design is kept between the calls.
+  The subsets used to prove outputs are saved in p->vOutCubes.
+  Returns the number of outputs proved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManProveOutputs( Pdr_Man_t * p, int iFrame )
+{
+    int nBTLimit = 1000;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(p->pAig) );
+    int iFiVarBeg = 1 + Saig_ManPoNum(p->pAig);
+    int i, k, iFoVarBeg, iActVar, iRoundVar, status, nProved = 0, nLemmas = 0;
+    Vec_Ptr_t * vCubes = Vec_VecEntry( p->vClauses, Vec_PtrSize(p->vSolvers)-1 );
+    Vec_Int_t * vActs, * vNexts, * vLits;
+    Pdr_Set_t * pCube;
+    sat_solver * pSat;
+    abctime clk = Abc_Clock();
+    assert( p->pPars->vOutMap != NULL );
+    // derive CNF for one frame of the design
+    if ( p->pCnfOuts == NULL )
+    {
+        Gia_Man_t * pGia = Gia_ManFromAigSimple( p->pAig );
+        p->pCnfOuts = (Cnf_Dat_t *)Mf_ManGenerateCnf( pGia, 8, 0, 0, 0, 0 );
+        Gia_ManStop( pGia );
+    }
+    // recycle the solver when too many activation variables are used up
+    if ( p->pSatOuts && sat_solver_nvars(p->pSatOuts) > 2 * p->pCnfOuts->nVars + 100000 )
+    {
+        sat_solver_delete( p->pSatOuts );
+        p->pSatOuts = NULL;
+    }
+    if ( p->pSatOuts == NULL )
+        p->pSatOuts = (sat_solver *)Cnf_DataWriteIntoSolver( p->pCnfOuts, 1, 0 );
+    if ( p->pSatOuts == NULL )
+        return 0;
+    pSat = p->pSatOuts;
+    iFoVarBeg = p->pCnfOuts->nVars - Aig_ManRegNum(p->pAig);
+    // add the clauses in the current state guarded by activation literals
+    // and the variables implying the cubes in the next state
+    vLits  = Vec_IntAlloc( 100 );
+    vActs  = Vec_IntAlloc( Vec_PtrSize(vCubes) );
+    vNexts = Vec_IntAlloc( Vec_PtrSize(vCubes) );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        iActVar = sat_solver_addvar( pSat );
+        Vec_IntFill( vLits, 1, Abc_Var2Lit(iActVar, 1) );
+        for ( k = 0; k < pCube->nLits; k++ )
+            if ( pCube->Lits[k] != -1 )
+                Vec_IntPush( vLits, Abc_Var2Lit(iFoVarBeg + Abc_Lit2Var(pCube->Lits[k]), !Abc_LitIsCompl(pCube->Lits[k])) );
+        status = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+        assert( status == 1 );
+        Vec_IntPush( vActs, iActVar );
+        iActVar = sat_solver_addvar( pSat );
+        for ( k = 0; k < pCube->nLits; k++ )
+            if ( pCube->Lits[k] != -1 )
+            {
+                Vec_IntFillTwo( vLits, 2, Abc_Var2Lit(iActVar, 1), Abc_Var2Lit(iFiVarBeg + Abc_Lit2Var(pCube->Lits[k]), Abc_LitIsCompl(pCube->Lits[k])) );
+                status = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+                assert( status == 1 );
+            }
+        Vec_IntPush( vNexts, iActVar );
+    }
+    // drop the clauses violated in the next state until the remaining ones are inductive
+    while ( 1 )
+    {
+        // require that one of the remaining clauses is violated in the next state
+        iRoundVar = sat_solver_addvar( pSat );
+        Vec_IntFill( vLits, 1, Abc_Var2Lit(iRoundVar, 1) );
+        Vec_IntForEachEntry( vNexts, iActVar, i )
+            if ( iActVar != -1 )
+                Vec_IntPush( vLits, Abc_Var2Lit(iActVar, 0) );
+        if ( Vec_IntSize(vLits) == 1 )
+            break;
+        status = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+        assert( status == 1 );
+        Vec_IntFill( vLits, 1, Abc_Var2Lit(iRoundVar, 0) );
+        Vec_IntForEachEntry( vActs, iActVar, i )
+            if ( Vec_IntEntry(vNexts, i) != -1 )
+                Vec_IntPush( vLits, Abc_Var2Lit(iActVar, 0) );
+        status = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), nBTLimit, 0, 0, 0 );
+        Vec_IntFill( vLits, 1, Abc_Var2Lit(iRoundVar, 1) );
+        sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+        if ( status == l_False )
+            break;
+        if ( status == l_Undef ) // the subset is unknown
+        {
+            Vec_IntFill( vNexts, Vec_IntSize(vNexts), -1 );
+            break;
+        }
+        // drop the clauses violated by the satisfying assignment
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        {
+            if ( Vec_IntEntry(vNexts, i) == -1 )
+                continue;
+            for ( k = 0; k < pCube->nLits; k++ )
+                if ( pCube->Lits[k] != -1 && sat_solver_var_value(pSat, iFiVarBeg + Abc_Lit2Var(pCube->Lits[k])) == Abc_LitIsCompl(pCube->Lits[k]) )
+                    break;
+            if ( k == pCube->nLits )
+                Vec_IntWriteEntry( vNexts, i, -1 );
+        }
+    }
+    // collect the activation literals of the inductive clauses
+    Vec_IntClear( vLits );
+    Vec_IntForEachEntry( vActs, iActVar, k )
+        if ( Vec_IntEntry(vNexts, k) != -1 )
+            Vec_IntPush( vLits, Abc_Var2Lit(iActVar, 0) );
+    nLemmas = Vec_IntSize(vLits);
+    // check the undecided outputs (some may be proved without any clauses)
+    for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+    {
+        if ( Vec_IntEntry(p->pPars->vOutMap, i) != -2 ) // not unknown
+            continue;
+        Vec_IntShrink( vLits, nLemmas );
+        Vec_IntPush( vLits, Abc_Var2Lit(1+i, 0) );
+        status = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), nBTLimit, 0, 0, 0 );
+        if ( status != l_False )
+            continue;
+        Vec_IntWriteEntry( p->pPars->vOutMap, i, 1 ); // unsat
+        if ( p->vFrame4Outs )
+            Vec_IntWriteEntry( p->vFrame4Outs, i, iFrame );
+        p->pPars->nProveOuts++;
+        nProved++;
+        if ( p->pPars->fUseBridge )
+            Gia_ManToBridgeResult( stdout, 1, NULL, i );
+        if ( !p->pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was proved in frame %2d using %d shared clauses (solved %*d out of %*d outputs).\n",
+                nOutDigits, i, iFrame, nLemmas, nOutDigits, p->pPars->nFailOuts + p->pPars->nProveOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
+    }
+    // save the inductive clauses used to prove the outputs
+    if ( nProved > 0 )
+    {
+        if ( p->vOutCubes == NULL )
+            p->vOutCubes = Vec_PtrAlloc( 100 );
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+            if ( Vec_IntEntry(vNexts, i) != -1 )
+                Vec_PtrPush( p->vOutCubes, Pdr_SetDup(pCube) );
+        Vec_PtrUniqify2( p->vOutCubes, (int (*)(void **, void **))Pdr_SetCompare, (void (*)(void *))Pdr_SetDeref, NULL );
+    }
+    // disable the clauses of this frame
+    Vec_IntForEachEntry( vActs, iActVar, i )
+    {
+        Vec_IntFill( vLits, 1, Abc_Var2Lit(iActVar, 1) );
+        sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+    }
+    Vec_IntFree( vActs );
+    Vec_IntFree( vNexts );
+    Vec_IntFree( vLits );
+    p->tProve += Abc_Clock() - clk;
+    return nProved;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the status of each output into a file.]
+
+  Description [The summary lists the status, the frame where the output
+  was solved, and the runtime spent on the output.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManDumpQuoted( FILE * pFile, char * pStr )
+{
+    fputc( '\"', pFile );
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fprintf( pFile, "\\%c", *pStr );
+        else if ( *pStr == '\n' )
+            fprintf( pFile, "\\n" );
+        else if ( *pStr == '\t' )
+            fprintf( pFile, "\\t" );
+        else if ( (unsigned char)*pStr < 0x20 )
+            fprintf( pFile, "\\u%04x", (unsigned char)*pStr );
+        else
+            fputc( *pStr, pFile );
+    }
+    fputc( '\"', pFile );
+}
+void Pdr_ManDumpSummary( Pdr_Man_t * p, char * pFileName )
+{
+    FILE * pFile;
+    int i, Status;
+    if ( p->pPars->vOutMap == NULL )
+    {
+        Abc_Print( 1, "The per-output summary is only available in the multi-output mode.\n" );
+        return;
+    }
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" for writing.\n", pFileName );
+        return;
+    }
+    fprintf( pFile, "{\n" );
+    fprintf( pFile, "  \"name\" : " );
+    Pdr_ManDumpQuoted( pFile, p->pAig->pName ? p->pAig->pName : (char *)"" );
+    fprintf( pFile, ",\n" );
+    fprintf( pFile, "  \"outputs\" : %d,\n",   Saig_ManPoNum(p->pAig) );
+    fprintf( pFile, "  \"sat\" : %d,\n",       p->pPars->nFailOuts );
+    fprintf( pFile, "  \"unsat\" : %d,\n",     Vec_IntCountEntry(p->pPars->vOutMap, 1) );
+    fprintf( pFile, "  \"frames\" : %d,\n",    p->pPars->iFrame );
+    fprintf( pFile, "  \"time\" : %.3f,\n",    1.0*p->tTotal/CLOCKS_PER_SEC );
+    fprintf( pFile, "  \"status\" : [\n" );
+    Vec_IntForEachEntry( p->pPars->vOutMap, Status, i )
+    {
+        fprintf( pFile, "    { \"po\" : %d, \"status\" : \"%s\", ", i, Status == 0 ? "sat" : (Status == 1 ? "unsat" : "undec") );
+        fprintf( pFile, "\"frame\" : %d, ", p->vFrame4Outs ? Vec_IntEntry(p->vFrame4Outs, i) : -1 );
+        fprintf( pFile, "\"time\" : %.3f }%s\n", p->pTime4Solve ? 1.0*p->pTime4Solve[i]/CLOCKS_PER_SEC : 0.0, i < Vec_IntSize(p->pPars->vOutMap)-1 ? "," : "" );
+    }
+    fprintf( pFile, "  ]\n" );
+    fprintf( pFile, "}\n" );
+    fclose( pFile );
+    if ( !p->pPars->fSilent )
+        Abc_Print( 1, "Written the summary for %d outputs into file \"%s\".\n", Saig_ManPoNum(p->pAig), pFileName );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -300,6 +300,8 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(p->pAig) );
         p->pPars->vOutMap = Vec_IntAlloc( Saig_ManPoNum(pAig) );
         Vec_IntFill( p->pPars->vOutMap, Saig_ManPoNum(pAig), -2 );
+        p->pTime4Solve = ABC_CALLOC( abctime, Saig_ManPoNum(pAig) );
+        p->vFrame4Outs = Vec_IntStartFull( Saig_ManPoNum(pAig) );
     }
     return p;
 }
@@ -335,6 +337,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
         ABC_PRTP( "Containment", p->tContain,   p->tTotal );
         ABC_PRTP( "CNF compute", p->tCnf,       p->tTotal );
         ABC_PRTP( "Refinement ", p->tAbs,       p->tTotal );
+        if ( p->pPars->fProveOuts )
+        ABC_PRTP( "Prove outs ", p->tProve,     p->tTotal );
         ABC_PRTP( "TOTAL      ", p->tTotal,     p->tTotal );
         fflush( stdout );
     }
@@ -384,6 +388,17 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vRes      );  // final result
     Vec_PtrFreeP( &p->vInfCubes );
     ABC_FREE( p->pTime4Outs );
+    ABC_FREE( p->pTime4Solve );
+    Vec_IntFreeP( &p->vFrame4Outs );
+    Cnf_DataFree( p->pCnfOuts );
+    if ( p->pSatOuts )
+        sat_solver_delete( p->pSatOuts );
+    if ( p->vOutCubes )
+    {
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vOutCubes, pCla, i )
+            Pdr_SetDeref( pCla );
+        Vec_PtrFree( p->vOutCubes );
+    }
     if ( p->vCexes )
         Vec_PtrFreeFree( p->vCexes );
     // additional AIG data-members
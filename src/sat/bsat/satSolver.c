@@ -132,6 +132,11 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// watcher lists contain 2-lit clauses as one odd entry (the other literal)
+// and longer clauses as two entries (the even handle followed by the blocker literal);
+// the clause is not visited during propagation if its blocker literal is true
+static inline void     sat_solver_push_watch(veci* ws, cla h, lit blocker) { veci_push(ws, h); veci_push(ws, blocker); }
+
 //=================================================================================================
 // Variable order functions:
 
@@ -569,8 +574,15 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        // the handle of a long clause is followed by its blocker literal
+        sat_solver_push_watch(sat_solver_read_wlist(s,lit_neg(begin[0])), h, begin[1]);
+        sat_solver_push_watch(sat_solver_read_wlist(s,lit_neg(begin[1])), h, begin[0]);
+        return h;
+    }
+    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
 
     return h;
 }
@@ -1035,7 +1047,7 @@ int sat_solver_propagate(sat_solver* s)
         veci* ws    = sat_solver_read_wlist(s,p);
         int*  begin = veci_begin(ws);
         int*  end   = begin + veci_size(ws);
-        int*i, *j;
+        int*i, *j, nBlockers = 0;
 
         s->stats.propagations++;
 //        s->simpdb_props--;
@@ -1056,12 +1068,28 @@ int sat_solver_propagate(sat_solver* s)
                     (clause_begin(s->binary))[1] = lit_neg(p);
                     (clause_begin(s->binary))[0] = clause_read_lit(*i++);
                     // Copy the remaining watches:
-                    while (i < end)
+                    while (i < end){
+                        if (!clause_is_lit(*i))
+                            *j++ = *i++, nBlockers++;
                         *j++ = *i++;
+                    }
                 }
             }else{
 
-                clause* c = clause_read(s,*i);
+                cla h = *i;
+                clause* c;
+
+                // If the blocker is true, then clause is already satisfied.
+                lit blocker = i[1];
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    nBlockers++;
+                    continue;
+                }
+                i++;
+
+                c = clause_read(s,h);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1073,8 +1101,11 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
-                    *j++ = *i;
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
+                    *j++ = h;
+                    *j++ = lits[0];
+                    nBlockers++;
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1083,19 +1114,25 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_push_watch(sat_solver_read_wlist(s,lit_neg(lits[1])),h,lits[0]);
                             goto next; }
                     }
 
-                    *j++ = *i;
+                    *j++ = h;
+                    *j++ = lits[0];
+                    nBlockers++;
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
-                    if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                    if (!sat_solver_enqueue(s,lits[0], h)){
+                        hConfl = h;
+                        i++;
                         // Copy the remaining watches:
-                        while (i < end)
+                        while (i < end){
+                            if (!clause_is_lit(*i))
+                                *j++ = *i++, nBlockers++;
                             *j++ = *i++;
+                        }
                     }
                 }
             }
@@ -1103,7 +1140,8 @@ int sat_solver_propagate(sat_solver* s)
             i++;
         }
 
-        s->stats.inspects += j - veci_begin(ws);
+        // count the watches rather than the entries (a clause watch is followed by its blocker)
+        s->stats.inspects += j - veci_begin(ws) - nBlockers;
         veci_resize(ws,j - veci_begin(ws));
 #ifdef TEST_CNF_LOAD
         }
@@ -1595,12 +1633,18 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
-                pArray[j++] = pArray[k];
+            {
+                pArray[j++] = pArray[k++];
+                pArray[j++] = pArray[k]; // blocker
+            }
             else 
             {
-                c = clause_read(s, pArray[k]);
+                c = clause_read(s, pArray[k++]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k]; // blocker
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1662,7 +1706,12 @@ void sat_solver_rollback( sat_solver* s )
                     pArray[j++] = pArray[k];
             }
             else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
-                pArray[j++] = pArray[k];
+            {
+                pArray[j++] = pArray[k++];
+                pArray[j++] = pArray[k]; // blocker
+            }
+            else
+                k++; // skip blocker
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -49,12 +49,29 @@ static void Sat_SolverClauseWriteDimacs( FILE * pFile, clause * pC, int fIncreme
 ***********************************************************************/
 void Sat_SolverClauseWriteDimacs( FILE * pFile, clause * pC, int fIncrement )
 {
-    int i;
+    char Buffer[1024], Digits[16], * pCur = Buffer;
+    unsigned Value;
+    int i, k;
     for ( i = 0; i < (int)pC->size; i++ )
-        fprintf( pFile, "%s%d ", (lit_sign(pC->lits[i])? "-": ""),  lit_var(pC->lits[i]) + (fIncrement>0) );
+    {
+        if ( pCur - Buffer > 1000 )
+        {
+            fwrite( Buffer, 1, pCur - Buffer, pFile );
+            pCur = Buffer;
+        }
+        if ( lit_sign(pC->lits[i]) )
+            *pCur++ = '-';
+        Value = (unsigned)(lit_var(pC->lits[i]) + (fIncrement>0));
+        k = 0;
+        do Digits[k++] = (char)('0' + Value % 10); while ( (Value /= 10) );
+        while ( k )
+            *pCur++ = Digits[--k];
+        *pCur++ = ' ';
+    }
     if ( fIncrement )
-        fprintf( pFile, "0" );
-    fprintf( pFile, "\n" );
+        *pCur++ = '0';
+    *pCur++ = '\n';
+    fwrite( Buffer, 1, pCur - Buffer, pFile );
 }
 
 /**Function*************************************************************
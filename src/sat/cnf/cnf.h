@@ -50,6 +50,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
+typedef struct Cnf_Inc_t_            Cnf_Inc_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
 
 // the CNF asserting outputs of AIG to be 1
@@ -142,12 +143,27 @@ extern void            Cnf_CutUpdateRefs( Cnf_Man_t * p, Cnf_Cut_t * pCut, Cnf_C
 extern Cnf_Cut_t *     Cnf_CutCompose( Cnf_Man_t * p, Cnf_Cut_t * pCut, Cnf_Cut_t * pCutFan, int iFan );
 /*=== cnfData.c ========================================================*/
 extern void            Cnf_ReadMsops( char ** ppSopSizes, char *** ppSops );
+/*=== cnfDimacs.c ========================================================*/
+extern void            Cnf_DataWriteIntoFileThreads( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists, int nThreads );
+extern Cnf_Dat_t *     Cnf_DataReadFromFileThreads( char * pFileName, int nThreads );
 /*=== cnfFast.c ========================================================*/
 extern void            Cnf_CollectLeaves( Aig_Obj_t * pRoot, Vec_Ptr_t * vSuper, int fStopCompl );
 extern void            Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, Vec_Ptr_t * vLeaves, 
                            Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses );
 extern void            Cnf_DeriveFastMark( Aig_Man_t * p );
 extern Cnf_Dat_t *     Cnf_DeriveFast( Aig_Man_t * p, int nOutputs );
+/*=== cnfInc.c ========================================================*/
+extern Cnf_Inc_t *     Cnf_IncStart( Aig_Man_t * pAig );
+extern void            Cnf_IncStop( Cnf_Inc_t * p );
+extern void *          Cnf_IncSolver( Cnf_Inc_t * p );
+extern int             Cnf_IncObjLit( Cnf_Inc_t * p, Aig_Obj_t * pObj );
+extern int             Cnf_IncActStart( Cnf_Inc_t * p );
+extern int             Cnf_IncAddClause( Cnf_Inc_t * p, int * pLits, int nLits, int iAct );
+extern void            Cnf_IncActStop( Cnf_Inc_t * p, int iAct );
+extern int             Cnf_IncSolve( Cnf_Inc_t * p, int * pLits, int nLits, int nConfLimit );
+extern int             Cnf_IncObjValue( Cnf_Inc_t * p, Aig_Obj_t * pObj );
+extern void            Cnf_IncPrintStats( Cnf_Inc_t * p );
+extern Vec_Int_t *     Cnf_IncSolveOutputs( Aig_Man_t * pAig, int nConfLimit, int ** ppModel, int fVerbose );
 /*=== cnfMan.c ========================================================*/
 extern Cnf_Man_t *     Cnf_ManStart();
 extern void            Cnf_ManStop( Cnf_Man_t * p );
@@ -0,0 +1,547 @@
+/**CFile****************************************************************
+
+  FileName    [cnfDimacs.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Fast reading and writing of CNF in DIMACS format.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: cnfDimacs.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "misc/zlib/zlib.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CNF_THR_MAX    64         // the largest number of threads
+#define CNF_BLOCK   (1 << 20)     // the number of literals formatted by one thread at a time
+
+typedef struct Cnf_DimPart_t_ Cnf_DimPart_t;
+struct Cnf_DimPart_t_
+{
+    // writing
+    Cnf_Dat_t *    pCnf;          // the CNF
+    int            iBeg;          // the first clause
+    int            iEnd;          // the clause after the last one
+    int            fReadable;     // use readable variable numbers
+    char *         pBuffer;       // formatted clauses
+    int            nBuffer;       // the number of characters used
+    int            nBufferAlloc;  // the number of characters allocated
+    // reading
+    char *         pBeg;          // the first character
+    char *         pEnd;          // the character after the last one
+    Vec_Int_t *    vLits;         // literals and clause terminators (-1)
+    int            nVarsMax;      // the largest variable
+    int            fStop;         // end-of-data mark ('%') was found
+    char *         pError;        // the position of the unexpected character
+};
+
+static inline int Cnf_Lit2Var( int Lit )        { return (Lit & 1)? -(Lit >> 1)-1 : (Lit >> 1)+1;  }
+static inline int Cnf_Lit2Var2( int Lit )       { return (Lit & 1)? -(Lit >> 1)   : (Lit >> 1);    }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Formats the integer.]
+
+  Description [Returns the position after the last digit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Cnf_DimacsWriteInt( char * pBuffer, int Num )
+{
+    char Digits[16];
+    unsigned Value;
+    int i = 0;
+    if ( Num < 0 )
+    {
+        *pBuffer++ = '-';
+        Value = 0 - (unsigned)Num;
+    }
+    else
+        Value = (unsigned)Num;
+    do Digits[i++] = (char)('0' + Value % 10); while ( (Value /= 10) );
+    while ( i )
+        *pBuffer++ = Digits[--i];
+    return pBuffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Formats the clauses of one part.]
+
+  Description [Each literal takes at most 12 characters, which is used
+  to reserve the memory before formatting.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_DimacsWritePart( Cnf_DimPart_t * p )
+{
+    int * pLit, * pStop, i;
+    int nLits = p->pCnf->pClauses[p->iEnd] - p->pCnf->pClauses[p->iBeg];
+    int nAlloc = 12 * (nLits + p->iEnd - p->iBeg) + 16;
+    char * pCur;
+    if ( p->nBufferAlloc < nAlloc )
+    {
+        p->pBuffer = ABC_REALLOC( char, p->pBuffer, nAlloc );
+        p->nBufferAlloc = nAlloc;
+    }
+    pCur = p->pBuffer;
+    for ( i = p->iBeg; i < p->iEnd; i++ )
+    {
+        for ( pLit = p->pCnf->pClauses[i], pStop = p->pCnf->pClauses[i+1]; pLit < pStop; pLit++ )
+        {
+            pCur = Cnf_DimacsWriteInt( pCur, p->fReadable ? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
+            *pCur++ = ' ';
+        }
+        *pCur++ = '0';
+        *pCur++ = '\n';
+    }
+    p->nBuffer = pCur - p->pBuffer;
+    assert( p->nBuffer <= p->nBufferAlloc );
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Cnf_DimacsWriteWorker( void * pArg )
+{
+    Cnf_DimacsWritePart( (Cnf_DimPart_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF into a file.]
+
+  Description [The clauses are divided into blocks with about the same
+  number of literals. In each round, every thread formats one block into
+  its own buffer, and the buffers are written into the file in order.
+  This keeps the memory proportional to the number of threads rather
+  than to the size of the CNF. If the file name ends with ".gz", the
+  output is compressed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_DataWriteIntoFileThreads( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists, int nThreads )
+{
+    Cnf_DimPart_t Parts[CNF_THR_MAX], * pPart;
+    FILE * pFile = NULL;
+    gzFile pGz = NULL;
+    Vec_Str_t * vHead = Vec_StrAlloc( 1000 );
+    int i, k, iClause, nParts, VarId;
+    int fGz = !strncmp(pFileName+strlen(pFileName)-3,".gz",3);
+    if ( fGz )
+        pGz = gzopen( pFileName, "wb" );
+    else
+        pFile = fopen( pFileName, "w" );
+    if ( pGz == NULL && pFile == NULL )
+    {
+        printf( "Cnf_WriteIntoFile(): Output file cannot be opened.\n" );
+        Vec_StrFree( vHead );
+        return;
+    }
+    // write the header
+    Vec_StrPrintStr( vHead, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    Vec_StrPrintStr( vHead, "p cnf " );
+    Vec_StrPrintNum( vHead, p->nVars );
+    Vec_StrPush( vHead, ' ' );
+    Vec_StrPrintNum( vHead, p->nClauses );
+    Vec_StrPush( vHead, '\n' );
+    if ( vForAlls )
+    {
+        Vec_StrPrintStr( vHead, "a " );
+        Vec_IntForEachEntry( vForAlls, VarId, i )
+        {
+            Vec_StrPrintNum( vHead, fReadable? VarId : VarId+1 );
+            Vec_StrPush( vHead, ' ' );
+        }
+        Vec_StrPrintStr( vHead, "0\n" );
+    }
+    if ( vExists )
+    {
+        Vec_StrPrintStr( vHead, "e " );
+        Vec_IntForEachEntry( vExists, VarId, i )
+        {
+            Vec_StrPrintNum( vHead, fReadable? VarId : VarId+1 );
+            Vec_StrPush( vHead, ' ' );
+        }
+        Vec_StrPrintStr( vHead, "0\n" );
+    }
+    if ( pGz )
+        gzwrite( pGz, Vec_StrArray(vHead), Vec_StrSize(vHead) );
+    else
+        fwrite( Vec_StrArray(vHead), 1, Vec_StrSize(vHead), pFile );
+    Vec_StrFree( vHead );
+    // write the clauses
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, CNF_THR_MAX) );
+    memset( Parts, 0, sizeof(Cnf_DimPart_t) * nThreads );
+    for ( iClause = 0; iClause < p->nClauses; )
+    {
+        // divide the next clauses into blocks
+        for ( nParts = 0; nParts < nThreads && iClause < p->nClauses; nParts++ )
+        {
+            int * pLimit = p->pClauses[iClause] + CNF_BLOCK;
+            pPart = Parts + nParts;
+            pPart->pCnf      = p;
+            pPart->fReadable = fReadable;
+            pPart->iBeg      = iClause++;
+            while ( iClause < p->nClauses && p->pClauses[iClause] < pLimit )
+                iClause++;
+            pPart->iEnd      = iClause;
+        }
+        // format the blocks
+#ifdef ABC_USE_PTHREADS
+        if ( nParts > 1 )
+        {
+            pthread_t WorkerThread[CNF_THR_MAX];
+            int status;
+            for ( k = 0; k < nParts; k++ )
+            {
+                status = pthread_create( WorkerThread + k, NULL, Cnf_DimacsWriteWorker, (void *)(Parts + k) );  assert( status == 0 );
+            }
+            for ( k = 0; k < nParts; k++ )
+            {
+                status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+            }
+        }
+        else
+#endif
+        for ( k = 0; k < nParts; k++ )
+            Cnf_DimacsWritePart( Parts + k );
+        // write them in order
+        for ( k = 0; k < nParts; k++ )
+            if ( pGz )
+                gzwrite( pGz, Parts[k].pBuffer, Parts[k].nBuffer );
+            else
+                fwrite( Parts[k].pBuffer, 1, Parts[k].nBuffer, pFile );
+    }
+    for ( k = 0; k < nThreads; k++ )
+        ABC_FREE( Parts[k].pBuffer );
+    if ( pGz )
+    {
+        gzwrite( pGz, "\n", 1 );
+        gzclose( pGz );
+    }
+    else
+    {
+        fwrite( "\n", 1, 1, pFile );
+        fclose( pFile );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the contents of the file.]
+
+  Description [Files with extension ".gz" are decompressed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Cnf_DimacsReadContents( char * pFileName, int * pnSize )
+{
+    char * pContents;
+    int nSize = 0, nCap = (1 << 20), nRead;
+    if ( strncmp(pFileName+strlen(pFileName)-3,".gz",3) )
+    {
+        FILE * pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        fseek( pFile, 0, SEEK_END );
+        nSize = ftell( pFile );
+        rewind( pFile );
+        pContents = ABC_ALLOC( char, nSize + 1 );
+        nSize = fread( pContents, 1, nSize, pFile );
+        fclose( pFile );
+    }
+    else
+    {
+        gzFile pGz = gzopen( pFileName, "rb" );
+        if ( pGz == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nCap + 1 );
+        while ( (nRead = gzread( pGz, pContents + nSize, nCap - nSize )) > 0 )
+        {
+            nSize += nRead;
+            if ( nSize < nCap )
+                continue;
+            if ( nCap == 0x7FFFFFFE )
+            {
+                nRead = -1;
+                break;
+            }
+            nCap = nCap > 0x3FFFFFFE ? 0x7FFFFFFE : 2 * nCap;
+            pContents = ABC_REALLOC( char, pContents, nCap + 1 );
+        }
+        gzclose( pGz );
+        if ( nRead < 0 )
+        {
+            printf( "Cnf_DataReadFromFile(): Cannot decompress file \"%s\".\n", pFileName );
+            ABC_FREE( pContents );
+            return NULL;
+        }
+    }
+    pContents[nSize] = 0;
+    *pnSize = nSize;
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the clauses of one part.]
+
+  Description [The part starts at the beginning of a line. The literals
+  are collected with -1 marking the end of each clause. A clause may
+  continue in the next part, which is resolved when the parts are merged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_DimacsReadPart( Cnf_DimPart_t * p )
+{
+    char * pCur = p->pBeg;
+    int fComp, Var;
+    Vec_IntClear( p->vLits );
+    while ( pCur < p->pEnd )
+    {
+        if ( *pCur == ' ' || *pCur == '\t' || *pCur == '\r' || *pCur == '\n' )
+        {
+            pCur++;
+            continue;
+        }
+        if ( *pCur == 'c' )
+        {
+            while ( pCur < p->pEnd && *pCur != '\n' )
+                pCur++;
+            continue;
+        }
+        if ( *pCur == '%' )
+        {
+            p->fStop = 1;
+            return;
+        }
+        fComp = 0;
+        if ( *pCur == '-' )
+            fComp = 1, pCur++;
+        else if ( *pCur == '+' )
+            pCur++;
+        if ( (unsigned)(*pCur - '0') > 9 )
+        {
+            p->pError = pCur;
+            return;
+        }
+        for ( Var = 0; (unsigned)(*pCur - '0') <= 9; pCur++ )
+            Var = 10 * Var + (*pCur - '0');
+        if ( Var == 0 )
+        {
+            Vec_IntPush( p->vLits, -1 );
+            continue;
+        }
+        p->nVarsMax = Abc_MaxInt( p->nVarsMax, Var );
+        Vec_IntPush( p->vLits, Abc_Var2Lit(Var-1, fComp) );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Cnf_DimacsReadWorker( void * pArg )
+{
+    Cnf_DimacsReadPart( (Cnf_DimPart_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Reads CNF from a file in DIMACS format.]
+
+  Description [After the header is parsed, the rest of the file is
+  divided into parts at line breaks, the parts are parsed by separate
+  threads, and the results are concatenated in order. Clauses may span
+  several lines. Files with extension ".gz" are decompressed. As in the
+  readers of the SAT solvers, the header "p cnf" may be missing, and the
+  number of variables is increased to cover all literals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DataReadFromFileThreads( char * pFileName, int nThreads )
+{
+    Cnf_DimPart_t Parts[CNF_THR_MAX], * pPart;
+    Cnf_Dat_t * pCnf = NULL;
+    char * pBuffer, * pCur, * pLimit;
+    int i, k, Lit, nSize, nParts, nVars = -1, nClas = -1, nLits = 0, nClasRead = 0, nVarsMax = 0, fStop = 0;
+    int * pLits;
+    pBuffer = Cnf_DimacsReadContents( pFileName, &nSize );
+    if ( pBuffer == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return NULL;
+    }
+    pLimit = pBuffer + nSize;
+    // skip the comments and parse the header
+    for ( pCur = pBuffer; pCur < pLimit; pCur++ )
+    {
+        if ( *pCur == 'c' )
+            while ( pCur < pLimit && *pCur != '\n' )
+                pCur++;
+        else if ( *pCur == 'p' )
+            break;
+        else if ( *pCur != ' ' && *pCur != '\t' && *pCur != '\r' && *pCur != '\n' )
+            break;
+    }
+    if ( pCur < pLimit && *pCur == 'p' )
+    {
+        if ( sscanf( pCur, "p cnf %d %d", &nVars, &nClas ) != 2 )
+        {
+            printf( "Incorrect input file.\n" );
+            ABC_FREE( pBuffer );
+            return NULL;
+        }
+        if ( nVars < 0 || nClas < 0 )
+        {
+            printf( "Incorrect parameters.\n" );
+            ABC_FREE( pBuffer );
+            return NULL;
+        }
+        while ( pCur < pLimit && *pCur != '\n' )
+            pCur++;
+    }
+    // divide the clauses into parts starting at the beginning of a line
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, CNF_THR_MAX) );
+    if ( pLimit - pCur < (1 << 16) )
+        nThreads = 1;
+    memset( Parts, 0, sizeof(Cnf_DimPart_t) * nThreads );
+    for ( nParts = 0; nParts < nThreads && pCur < pLimit; nParts++ )
+    {
+        pPart = Parts + nParts;
+        pPart->pBeg = pCur;
+        pCur = nParts == nThreads - 1 ? pLimit : pCur + (pLimit - pCur) / (nThreads - nParts);
+        while ( pCur < pLimit && *pCur != '\n' )
+            pCur++;
+        pPart->pEnd  = pCur;
+        pPart->vLits = Vec_IntAlloc( (int)((pPart->pEnd - pPart->pBeg) / 3) + 16 );
+    }
+    // parse the parts
+#ifdef ABC_USE_PTHREADS
+    if ( nParts > 1 )
+    {
+        pthread_t WorkerThread[CNF_THR_MAX];
+        int status;
+        for ( k = 0; k < nParts; k++ )
+        {
+            status = pthread_create( WorkerThread + k, NULL, Cnf_DimacsReadWorker, (void *)(Parts + k) );  assert( status == 0 );
+        }
+        for ( k = 0; k < nParts; k++ )
+        {
+            status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+        }
+    }
+    else
+#endif
+    for ( k = 0; k < nParts; k++ )
+        Cnf_DimacsReadPart( Parts + k );
+    // check the parts up to the end-of-data mark
+    for ( k = 0; k < nParts && !fStop; k++ )
+    {
+        if ( Parts[k].pError )
+        {
+            int iLine = 1;
+            for ( pCur = pBuffer; pCur < Parts[k].pError; pCur++ )
+                iLine += (*pCur == '\n');
+            printf( "Unexpected character \'%c\' in line %d.\n", *Parts[k].pError, iLine );
+            goto finish;
+        }
+        nLits   += Vec_IntSize(Parts[k].vLits);
+        nVarsMax = Abc_MaxInt( nVarsMax, Parts[k].nVarsMax );
+        fStop    = Parts[k].fStop;
+    }
+    nParts = k;
+    if ( nVarsMax > nVars && nVars >= 0 )
+        printf( "Warning! Literal %d is out-of-bound for %d variables.\n", nVarsMax, nVars );
+    nVars = Abc_MaxInt( nVars, nVarsMax );
+    // count the clauses
+    for ( k = 0; k < nParts; k++ )
+        Vec_IntForEachEntry( Parts[k].vLits, Lit, i )
+            nClasRead += (Lit == -1);
+    if ( nLits > 0 && Vec_IntEntryLast(Parts[nParts-1].vLits) != -1 )
+    {
+        printf( "There is no zero-terminator after the last clause.\n" );
+        goto finish;
+    }
+    if ( nClasRead != nClas && nClas >= 0 )
+        printf( "Warning! The number of clauses (%d) is different from declaration (%d).\n", nClasRead, nClas );
+    // create the CNF
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->nVars     = nVars;
+    pCnf->nClauses  = nClasRead;
+    pCnf->nLiterals = nLits - nClasRead;
+    pCnf->pClauses  = ABC_ALLOC( int *, nClasRead + 1 );
+    pCnf->pClauses[0] = pLits = ABC_ALLOC( int, Abc_MaxInt(1, nLits - nClasRead) );
+    for ( nClasRead = 0, k = 0; k < nParts; k++ )
+        Vec_IntForEachEntry( Parts[k].vLits, Lit, i )
+            if ( Lit == -1 )
+                pCnf->pClauses[++nClasRead] = pLits;
+            else
+                *pLits++ = Lit;
+    assert( nClasRead == pCnf->nClauses );
+finish:
+    for ( k = 0; k < nThreads; k++ )
+        Vec_IntFreeP( &Parts[k].vLits );
+    ABC_FREE( pBuffer );
+    return pCnf;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
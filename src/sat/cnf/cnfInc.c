@@ -0,0 +1,414 @@
+/**CFile****************************************************************
+
+  FileName    [cnfInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Incremental loading of CNF into the SAT solver.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: cnfInc.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "sat/bsat/satSolver.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the CNF of the AIG is derived once; the clauses of each object are
+// added to the solver only when the object appears in the cone of a query
+struct Cnf_Inc_t_
+{
+    Aig_Man_t *     pAig;            // the AIG manager
+    Cnf_Dat_t *     pCnf;            // the CNF with var numbers equal to object IDs
+    sat_solver *    pSat;            // the SAT solver
+    Vec_Str_t *     vLoaded;         // marks objects whose clauses are in the solver
+    Vec_Int_t *     vActs;           // currently active activation variables
+    Vec_Int_t *     vStack;          // temporary storage for cone traversal
+    Vec_Int_t *     vLits;           // temporary storage for literals
+    int             fUnsat;          // the clauses in the solver are UNSAT
+    // statistics
+    int             nObjsLoaded;     // the number of objects loaded
+    int             nClasLoaded;     // the number of clauses loaded
+    int             nActsUsed;       // the number of activation variables used
+    int             nCalls;          // the number of SAT calls
+    abctime         timeCnf;         // CNF derivation time
+    abctime         timeSat;         // SAT solving time
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the incremental CNF manager.]
+
+  Description [Derives the CNF of the whole AIG once. The clauses are
+  not added to the solver until they are needed by a query.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Inc_t * Cnf_IncStart( Aig_Man_t * pAig )
+{
+    Cnf_Inc_t * p;
+    abctime clk = Abc_Clock();
+    p = ABC_CALLOC( Cnf_Inc_t, 1 );
+    p->pAig    = pAig;
+    p->pCnf    = Cnf_DeriveOther( pAig, 1 );
+    p->pSat    = sat_solver_new();
+    sat_solver_setnvars( p->pSat, p->pCnf->nVars );
+    p->vLoaded = Vec_StrStart( p->pCnf->nVars );
+    p->vActs   = Vec_IntAlloc( 16 );
+    p->vStack  = Vec_IntAlloc( 1000 );
+    p->vLits   = Vec_IntAlloc( 100 );
+    p->timeCnf = Abc_Clock() - clk;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the incremental CNF manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_IncStop( Cnf_Inc_t * p )
+{
+    Cnf_DataFree( p->pCnf );
+    sat_solver_delete( p->pSat );
+    Vec_StrFree( p->vLoaded );
+    Vec_IntFree( p->vActs );
+    Vec_IntFree( p->vStack );
+    Vec_IntFree( p->vLits );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cnf_IncSolver( Cnf_Inc_t * p )
+{
+    return p->pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of the cone of the object to the solver.]
+
+  Description [Objects whose clauses are already in the solver are
+  skipped, so the cost of repeated queries is proportional to the
+  size of the part of the cone that was not seen before. Returns 0 
+  if the solver became UNSAT while adding the clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_IncLoadCone( Cnf_Inc_t * p, int iObj )
+{
+    int i, k, iVar, iClaBeg, iClaEnd, * pBeg, * pEnd;
+    if ( p->fUnsat )
+        return 0;
+    if ( Vec_StrEntry(p->vLoaded, iObj) )
+        return 1;
+    // an object is marked by 2 when it is scheduled and by 1 when its clauses are added
+    Vec_StrWriteEntry( p->vLoaded, iObj, 2 );
+    Vec_IntClear( p->vStack );
+    Vec_IntPush( p->vStack, iObj );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iObj = Vec_IntPop( p->vStack );
+        assert( p->pCnf->pObj2Count[iObj] >= 0 );
+        p->nObjsLoaded++;
+        iClaBeg = p->pCnf->pObj2Clause[iObj];
+        iClaEnd = iClaBeg + p->pCnf->pObj2Count[iObj];
+        for ( i = iClaBeg; i < iClaEnd; i++ )
+        {
+            pBeg = p->pCnf->pClauses[i];
+            pEnd = p->pCnf->pClauses[i+1];
+            assert( Abc_Lit2Var(pBeg[0]) == iObj );
+            // the first literal belongs to the object; the others to its fanins
+            for ( k = 1; k < pEnd - pBeg; k++ )
+            {
+                iVar = Abc_Lit2Var( pBeg[k] );
+                if ( Vec_StrEntry(p->vLoaded, iVar) )
+                    continue;
+                Vec_StrWriteEntry( p->vLoaded, iVar, 2 );
+                Vec_IntPush( p->vStack, iVar );
+            }
+            if ( !sat_solver_addclause( p->pSat, pBeg, pEnd ) )
+            {
+                // the clauses of this object and of the scheduled ones are not loaded
+                Vec_StrWriteEntry( p->vLoaded, iObj, 0 );
+                Vec_IntForEachEntry( p->vStack, iVar, k )
+                    Vec_StrWriteEntry( p->vLoaded, iVar, 0 );
+                p->fUnsat = 1;
+                return 0;
+            }
+            p->nClasLoaded++;
+        }
+        Vec_StrWriteEntry( p->vLoaded, iObj, 1 );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT literal of the object.]
+
+  Description [The object can be complemented. It should be a CI, a CO,
+  the constant node, or an internal node used in the mapping (for example,
+  the driver of a CO). Loads the cone of the object, if needed. If the
+  solver becomes UNSAT while loading, this is recorded, and all following
+  calls to Cnf_IncSolve() return UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncObjLit( Cnf_Inc_t * p, Aig_Obj_t * pObj )
+{
+    int iObj = Aig_Regular(pObj)->Id;
+    Cnf_IncLoadCone( p, iObj ); // the failure is recorded in p->fUnsat
+    return Abc_Var2Lit( iObj, Aig_IsComplement(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a new activation variable.]
+
+  Description [Clauses added with this variable are enforced in all
+  calls to Cnf_IncSolve() until the variable is retracted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncActStart( Cnf_Inc_t * p )
+{
+    int iAct = sat_solver_addvar( p->pSat );
+    Vec_IntPush( p->vActs, iAct );
+    p->nActsUsed++;
+    return iAct;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds a clause that can be retracted later.]
+
+  Description [If iAct is -1, the clause is added permanently. Returns 0
+  if the solver is UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncAddClause( Cnf_Inc_t * p, int * pLits, int nLits, int iAct )
+{
+    int i;
+    Vec_IntClear( p->vLits );
+    for ( i = 0; i < nLits; i++ )
+        Vec_IntPush( p->vLits, pLits[i] );
+    if ( iAct >= 0 )
+        Vec_IntPush( p->vLits, Abc_Var2Lit(iAct, 1) );
+    if ( p->fUnsat || !sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) ) )
+        p->fUnsat = 1;
+    return !p->fUnsat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Retracts the clauses added with the activation variable.]
+
+  Description [The clauses become satisfied by a unit clause and are
+  removed by the solver during the next simplification.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_IncActStop( Cnf_Inc_t * p, int iAct )
+{
+    int Lit = Abc_Var2Lit( iAct, 1 );
+    if ( !Vec_IntRemove( p->vActs, iAct ) ) // not an activation variable in use
+        return;
+    if ( !p->fUnsat && !sat_solver_addclause( p->pSat, &Lit, &Lit + 1 ) )
+        p->fUnsat = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under the given assumptions.]
+
+  Description [The literals of the active activation variables are added
+  to the assumptions. Returns 1 if UNSAT, 0 if SAT, and -1 if undecided.
+  Returns 1 without solving if adding clauses has made the solver UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncSolve( Cnf_Inc_t * p, int * pLits, int nLits, int nConfLimit )
+{
+    int i, iAct, status;
+    abctime clk = Abc_Clock();
+    p->nCalls++;
+    if ( p->fUnsat )
+        return 1;
+    Vec_IntClear( p->vLits );
+    for ( i = 0; i < nLits; i++ )
+        Vec_IntPush( p->vLits, pLits[i] );
+    Vec_IntForEachEntry( p->vActs, iAct, i )
+        Vec_IntPush( p->vLits, Abc_Var2Lit(iAct, 0) );
+    status = sat_solver_solve( p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits), (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    p->timeSat += Abc_Clock() - clk;
+    if ( status == l_False )
+        return 1;
+    if ( status == l_True )
+        return 0;
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the value of the object in the last satisfying assignment.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncObjValue( Cnf_Inc_t * p, Aig_Obj_t * pObj )
+{
+    int iObj = Aig_Regular(pObj)->Id;
+    if ( !Vec_StrEntry(p->vLoaded, iObj) )
+        return 0;
+    return sat_solver_var_value( p->pSat, iObj ) ^ Aig_IsComplement(pObj);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the incremental CNF manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_IncPrintStats( Cnf_Inc_t * p )
+{
+    printf( "Incremental CNF: Calls = %d.  Objs = %d (%.2f %%).  Clauses = %d (%.2f %%).  Acts = %d.  Conflicts = %d.\n",
+        p->nCalls,
+        p->nObjsLoaded, 100.0 * p->nObjsLoaded / Abc_MaxInt(1, Aig_ManObjNum(p->pAig)),
+        p->nClasLoaded, 100.0 * p->nClasLoaded / Abc_MaxInt(1, p->pCnf->nClauses),
+        p->nActsUsed, sat_solver_nconflicts(p->pSat) );
+    ABC_PRT( "CNF    ", p->timeCnf );
+    ABC_PRT( "SAT    ", p->timeSat );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the combinational miter one at a time.]
+
+  Description [Uses one solver for all outputs, so that the CNF of the
+  shared logic is loaded once and the learned clauses are reused.
+  Returns the array of output statuses (1 = UNSAT, 0 = SAT, -1 = undecided).
+  If ppModel is not NULL, returns the CI values for the first satisfiable
+  output in it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cnf_IncSolveOutputs( Aig_Man_t * pAig, int nConfLimit, int ** ppModel, int fVerbose )
+{
+    Cnf_Inc_t * p;
+    Vec_Int_t * vStatus;
+    Aig_Obj_t * pObj, * pCi;
+    int i, k, Lit, status;
+    assert( Aig_ManRegNum(pAig) == 0 );
+    if ( ppModel )
+        *ppModel = NULL;
+    p = Cnf_IncStart( pAig );
+    vStatus = Vec_IntStartFull( Aig_ManCoNum(pAig) );
+    Aig_ManForEachCo( pAig, pObj, i )
+    {
+        if ( Aig_ObjFanin0(pObj) == Aig_ManConst1(pAig) )
+        {
+            Vec_IntWriteEntry( vStatus, i, Aig_ObjFaninC0(pObj) );
+            // the output is constant 1 - any assignment is a model
+            if ( !Aig_ObjFaninC0(pObj) && ppModel && *ppModel == NULL )
+                *ppModel = ABC_CALLOC( int, Aig_ManCiNum(pAig) );
+            continue;
+        }
+        Lit = Cnf_IncObjLit( p, pObj );
+        status = Cnf_IncSolve( p, &Lit, 1, nConfLimit );
+        Vec_IntWriteEntry( vStatus, i, status );
+        if ( status == 1 )
+        {
+            // the output is constant 0 - record this for the following calls
+            Lit = Abc_LitNot( Lit );
+            Cnf_IncAddClause( p, &Lit, 1, -1 );
+        }
+        else if ( status == 0 && ppModel && *ppModel == NULL )
+        {
+            *ppModel = ABC_CALLOC( int, Aig_ManCiNum(pAig) );
+            Aig_ManForEachCi( pAig, pCi, k )
+                (*ppModel)[k] = Cnf_IncObjValue( p, pCi );
+        }
+        if ( fVerbose )
+            printf( "Output %6d : %s\n", i, status == 1 ? "UNSAT" : (status == 0 ? "SAT" : "UNDEC") );
+    }
+    if ( fVerbose )
+        Cnf_IncPrintStats( p );
+    Cnf_IncStop( p );
+    return vStatus;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -602,43 +602,24 @@ void glucose_print_stats(SimpSolver& s, abctime clk)
   SeeAlso     []
 
 ***********************************************************************/
-void Glucose_ReadDimacs( char * pFileName, SimpSolver& s )
+int Glucose_ReadDimacs( char * pFileName, SimpSolver& s, int nThreads )
 {
     vec<Lit> * lits = &s.user_lits;
-    char * pBuffer = Extra_FileReadContents( pFileName );
-    char * pTemp; int fComp, Var, VarMax = 0;
-    lits->clear();
-    for ( pTemp = pBuffer; *pTemp; pTemp++ )
+    Cnf_Dat_t * pCnf = Cnf_DataReadFromFileThreads( pFileName, nThreads );
+    if ( pCnf == NULL )
+        return 0;
+    s.addVar( pCnf->nVars - 1 );
+    for ( int i = 0; i < pCnf->nClauses; i++ )
     {
-        if ( *pTemp == 'c' || *pTemp == 'p' ) {
-            while ( *pTemp != '\n' )
-                pTemp++;
+        if ( pCnf->pClauses[i] == pCnf->pClauses[i+1] )
             continue;
-        }
-        while ( *pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n' )
-            pTemp++;
-        fComp = 0;
-        if ( *pTemp == '-' )
-            fComp = 1, pTemp++;
-        if ( *pTemp == '+' )
-            pTemp++;
-        Var = atoi( pTemp );
-        if ( Var == 0 ) {
-            if ( lits->size() > 0 ) {
-                s.addVar( VarMax );
-                s.addClause(*lits);
-                lits->clear();
-            }
-        }
-        else {
-            Var--;
-            VarMax = Abc_MaxInt( VarMax, Var );
-            lits->push( toLit(Abc_Var2Lit(Var, fComp)) );
-        }
-        while ( *pTemp >= '0' && *pTemp <= '9' )
-            pTemp++;
+        lits->clear();
+        for ( int * pLit = pCnf->pClauses[i]; pLit < pCnf->pClauses[i+1]; pLit++ )
+            lits->push( toLit(*pLit) );
+        s.addClause(*lits);
     }
-    ABC_FREE( pBuffer );
+    Cnf_DataFree( pCnf );
+    return 1;
 }
 
 /**Function*************************************************************
@@ -663,7 +644,8 @@ void Glucose_SolveCnf( char * pFileName, Glucose_Pars * pPars )
 //    gzFile in = gzopen(pFilename, "rb");
 //    parse_DIMACS(in, S);
 //    gzclose(in);
-    Glucose_ReadDimacs( pFileName, S );
+    if ( !Glucose_ReadDimacs( pFileName, S, pPars->nThreads ) )
+        return;
 
     if ( pPars->verb )
     {
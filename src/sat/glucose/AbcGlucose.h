@@ -48,6 +48,7 @@ struct Glucose_Pars_ {
     int verb;    // verbosity
     int cust;    // customizable
     int nConfls; // conflict limit (0 = no limit)
+    int nThreads; // threads used to read CNF files
 };
 
 static inline Glucose_Pars Glucose_CreatePars(int p, int v, int c, int nConfls)
@@ -57,6 +58,7 @@ static inline Glucose_Pars Glucose_CreatePars(int p, int v, int c, int nConfls)
     pars.verb    = v;
     pars.cust    = c;
     pars.nConfls = nConfls;
+    pars.nThreads = 1;
     return pars;
 }
 